@@ -2,7 +2,9 @@
 
 #include <components/openmw-mp/NetworkMessages.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include "Networking.hpp"
 #include "Player.hpp"
 #include "Script/Script.hpp"
 
@@ -46,6 +48,12 @@ void Cell::addPlayer(Player *player)
 
     Script::Call<Script::CallbackIdentity("OnCellLoad")>(player->getId(), getDescription().c_str());
 
+    for (auto other : players)
+    {
+        other->addVisiblePlayer(player);
+        player->addVisiblePlayer(other);
+    }
+
     players.push_back(player);
 }
 
@@ -71,6 +79,22 @@ void Cell::removePlayer(Player *player, bool cleanPlayer)
             Script::Call<Script::CallbackIdentity("OnCellUnload")>(player->getId(), getDescription().c_str());
 
             players.erase(it);
+
+            for (auto other : players)
+            {
+                other->removeVisiblePlayer(player);
+                player->removeVisiblePlayer(other);
+            }
+
+            // The player no longer receives the positions of this cell's actors
+            mwmp::Networking *networking = mwmp::Networking::getPtr();
+
+            if (networking != nullptr)
+            {
+                for (const auto &actor : actors)
+                    networking->forgetActorPosition(player->guid, *actor);
+            }
+
             return;
         }
     }
@@ -80,13 +104,11 @@ void Cell::readActorList(unsigned char packetID, const mwmp::BaseActorList *newA
 {
     for (unsigned int i = 0; i < newActorList->count; i++)
     {
-        mwmp::BaseActor newActor = newActorList->baseActors.at(i);
-        mwmp::BaseActor *cellActor;
+        const mwmp::BaseActor &newActor = newActorList->baseActors.at(i);
+        mwmp::BaseActor *cellActor = getActor(newActor.refNum, newActor.mpNum);
 
-        if (containsActor(newActor.refNum, newActor.mpNum))
+        if (cellActor != nullptr)
         {
-            cellActor = getActor(newActor.refNum, newActor.mpNum);
-
             switch (packetID)
             {
             case ID_ACTOR_POSITION:
@@ -105,62 +127,54 @@ void Cell::readActorList(unsigned char packetID, const mwmp::BaseActorList *newA
             }
         }
         else
-            cellActorList.baseActors.push_back(newActor);
+        {
+            actors.push_back(std::unique_ptr<mwmp::BaseActor>(new mwmp::BaseActor(newActor)));
+            actorIndexes[getActorKey(newActor.refNum, newActor.mpNum)] = actors.back().get();
+        }
     }
-
-    cellActorList.count = cellActorList.baseActors.size();
 }
 
 bool Cell::containsActor(int refNum, int mpNum)
 {
-    for (unsigned int i = 0; i < cellActorList.baseActors.size(); i++)
-    {
-        mwmp::BaseActor actor = cellActorList.baseActors.at(i);
-
-        if (actor.refNum == refNum && actor.mpNum == mpNum)
-            return true;
-    }
-    return false;
+    return actorIndexes.find(getActorKey(refNum, mpNum)) != actorIndexes.end();
 }
 
 mwmp::BaseActor *Cell::getActor(int refNum, int mpNum)
 {
-    for (unsigned int i = 0; i < cellActorList.baseActors.size(); i++)
-    {
-        mwmp::BaseActor *actor = &cellActorList.baseActors.at(i);
+    auto it = actorIndexes.find(getActorKey(refNum, mpNum));
 
-        if (actor->refNum == refNum && actor->mpNum == mpNum)
-            return actor;
-    }
-    return 0;
+    if (it == actorIndexes.end())
+        return nullptr;
+
+    return it->second;
 }
 
 void Cell::removeActors(const mwmp::BaseActorList *newActorList)
 {
-    for (std::vector<mwmp::BaseActor>::iterator it = cellActorList.baseActors.begin(); it != cellActorList.baseActors.end();)
-    {
-        int refNum = (*it).refNum;
-        int mpNum = (*it).mpNum;
+    bool foundActor = false;
 
-        bool foundActor = false;
+    for (unsigned int i = 0; i < newActorList->count; i++)
+    {
+        const mwmp::BaseActor &newActor = newActorList->baseActors.at(i);
 
-        for (unsigned int i = 0; i < newActorList->count; i++)
+        if (actorIndexes.erase(getActorKey(newActor.refNum, newActor.mpNum)) > 0)
         {
-            mwmp::BaseActor newActor = newActorList->baseActors.at(i);
+            foundActor = true;
 
-            if (newActor.refNum == refNum && newActor.mpNum == mpNum)
-            {
-                it = cellActorList.baseActors.erase(it);
-                foundActor = true;
-                break;
-            }
+            // The actor has left this cell, so its next position is sent in full to whoever still receives it
+            for (auto player : players)
+                mwmp::Networking::get().forgetActorPosition(player->guid, newActor);
         }
-
-        if (!foundActor)
-            it++;
     }
 
-    cellActorList.count = cellActorList.baseActors.size();
+    if (!foundActor)
+        return;
+
+    // Actors still present in the index are the ones we keep, so compact the list in a single pass
+    // while preserving the order scripts see it in
+    actors.erase(std::remove_if(actors.begin(), actors.end(), [this](const std::unique_ptr<mwmp::BaseActor> &actor) {
+        return actorIndexes.find(getActorKey(actor->refNum, actor->mpNum)) == actorIndexes.end();
+    }), actors.end());
 }
 
 RakNet::RakNetGUID *Cell::getAuthority()
@@ -175,6 +189,13 @@ void Cell::setAuthority(const RakNet::RakNetGUID& guid)
 
 mwmp::BaseActorList *Cell::getActorList()
 {
+    cellActorList.baseActors.clear();
+    cellActorList.baseActors.reserve(actors.size());
+
+    for (const auto &actor : actors)
+        cellActorList.baseActors.push_back(*actor);
+
+    cellActorList.count = cellActorList.baseActors.size();
     return &cellActorList;
 }
 
@@ -188,25 +209,45 @@ void Cell::sendToLoaded(mwmp::ActorPacket *actorPacket, mwmp::BaseActorList *bas
     if (players.empty())
         return;
 
-    std::list <Player*> plList;
+    actorPacket->setActorList(baseActorList);
 
+    bool isSerialized = false;
+
+    // addPlayer() never adds the same player twice, so there are no duplicates to filter out
     for (auto pl : players)
     {
-        if (pl != nullptr && !pl->npc.mName.empty())
-            plList.push_back(pl);
-    }
+        if (pl == nullptr || pl->npc.mName.empty()) continue;
+
+        if (pl->guid == baseActorList->guid) continue;
 
-    plList.sort();
-    plList.unique();
+        // Packets with per-connection encoding, such as delta-encoded positions, are written
+        // separately for each guid
+        if (actorPacket->hasPerConnectionEncoding())
+        {
+            actorPacket->Send(pl->guid);
+            continue;
+        }
+
+        // Only encode the packet once and reuse the same bytes for every eligible guid
+        if (!isSerialized)
+        {
+            actorPacket->Serialize();
+            isSerialized = true;
+        }
+
+        actorPacket->SendSerialized(pl->guid);
+    }
+}
 
-    for (auto pl : plList)
+void Cell::relayToLoaded(RakNet::Packet &packet, mwmp::ActorPacket *actorPacket) const
+{
+    for (auto pl : players)
     {
-        if (pl->guid == baseActorList->guid) continue;
+        if (pl == nullptr || pl->npc.mName.empty()) continue;
 
-        actorPacket->setActorList(baseActorList);
+        if (pl->guid == packet.guid) continue;
 
-        // Send the packet to this eligible guid
-        actorPacket->Send(pl->guid);
+        actorPacket->Relay(packet.data, packet.length, pl->guid);
     }
 }
 
@@ -215,25 +256,33 @@ void Cell::sendToLoaded(mwmp::ObjectPacket *objectPacket, mwmp::BaseObjectList *
     if (players.empty())
         return;
 
-    std::list <Player*> plList;
+    objectPacket->setObjectList(baseObjectList);
+
+    bool isSerialized = false;
 
+    // addPlayer() never adds the same player twice, so there are no duplicates to filter out
     for (auto pl : players)
     {
-        if (pl != nullptr && !pl->npc.mName.empty())
-            plList.push_back(pl);
-    }
-
-    plList.sort();
-    plList.unique();
+        if (pl == nullptr || pl->npc.mName.empty()) continue;
 
-    for (auto pl : plList)
-    {
         if (pl->guid == baseObjectList->guid) continue;
 
-        objectPacket->setObjectList(baseObjectList);
+        // Packets with per-connection encoding, such as containers with indexed refIds, are written
+        // separately for each guid
+        if (objectPacket->hasPerConnectionEncoding())
+        {
+            objectPacket->Send(pl->guid);
+            continue;
+        }
+
+        // Only encode the packet once and reuse the same bytes for every eligible guid
+        if (!isSerialized)
+        {
+            objectPacket->Serialize();
+            isSerialized = true;
+        }
 
-        // Send the packet to this eligible guid
-        objectPacket->Send(pl->guid);
+        objectPacket->SendSerialized(pl->guid);
     }
 }
 
@@ -241,3 +290,8 @@ std::string Cell::getDescription() const
 {
     return cell.getDescription();
 }
+
+uint64_t Cell::getActorKey(unsigned int refNum, unsigned int mpNum)
+{
+    return (static_cast<uint64_t>(refNum) << 32) | mpNum;
+}
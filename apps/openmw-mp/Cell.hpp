@@ -2,7 +2,10 @@
 #define OPENMW_SERVERCELL_HPP
 
 #include <deque>
+#include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <components/esm/records.hpp>
 #include <components/openmw-mp/Base/BaseActor.hpp>
 #include <components/openmw-mp/Base/BaseObject.hpp>
@@ -39,14 +42,28 @@ public:
     void sendToLoaded(mwmp::ActorPacket *actorPacket, mwmp::BaseActorList *baseActorList) const;
     void sendToLoaded(mwmp::ObjectPacket *objectPacket, mwmp::BaseObjectList *baseObjectList) const;
 
+    // Send a received packet's bytes as they are to the players with this cell loaded, other than its sender
+    void relayToLoaded(RakNet::Packet &packet, mwmp::ActorPacket *actorPacket) const;
+
     std::string getDescription() const;
 
 
 private:
+    static uint64_t getActorKey(unsigned int refNum, unsigned int mpNum);
+
     TPlayers players;
     ESM::Cell cell;
 
     RakNet::RakNetGUID authorityGuid;
+
+    // Actors in the order they were added, each allocated separately so that pointers to them stay valid
+    // while other actors are added or removed
+    std::vector<std::unique_ptr<mwmp::BaseActor>> actors;
+
+    // The same actors keyed by their refNum and mpNum
+    std::unordered_map<uint64_t, mwmp::BaseActor*> actorIndexes;
+
+    // A copy of the actors handed out by getActorList()
     mwmp::BaseActorList cellActorList;
 };
 
@@ -1,5 +1,7 @@
 #include "CellController.hpp"
 
+#include <components/misc/stringops.hpp>
+
 #include <iostream>
 #include "Cell.hpp"
 #include "Player.hpp"
@@ -50,68 +52,53 @@ Cell *CellController::getCell(ESM::Cell *esmCell)
 
 Cell *CellController::getCellByXY(int x, int y)
 {
-    auto it = find_if(cells.begin(), cells.end(), [x, y](const Cell *c)
-    {
-        return c->cell.mData.mX == x && c->cell.mData.mY == y;
-    });
+    auto it = exteriorCells.find(getGridKey(x, y));
 
-    if (it == cells.end())
+    if (it == exteriorCells.end())
     {
         LOG_APPEND(TimedLog::LOG_INFO, "- Attempt to get Cell at %i, %i failed!", x, y);
         return nullptr;
     }
 
-    return *it;
+    return it->second;
 }
 
 Cell *CellController::getCellByName(std::string cellName)
 {
-    auto it = find_if(cells.begin(), cells.end(), [cellName](const Cell *c)
-    {
-        return c->cell.mName == cellName;
-    });
+    auto it = interiorCells.find(Misc::StringUtils::lowerCase(cellName));
 
-    if (it == cells.end())
+    if (it == interiorCells.end())
     {
         LOG_APPEND(TimedLog::LOG_INFO, "- Attempt to get Cell at %s failed!", cellName.c_str());
         return nullptr;
     }
 
-    return *it;
+    return it->second;
 }
 
 Cell *CellController::addCell(ESM::Cell cellData)
 {
     LOG_APPEND(TimedLog::LOG_INFO, "- Loaded cells: %d", cells.size());
-    auto it = find_if(cells.begin(), cells.end(), [cellData](const Cell *c) {
-        // Currently we cannot compare because plugin lists can be loaded in different order
-        //return c->cell.sRecordId == cellData.sRecordId;
-        if (c->cell.isExterior() && cellData.isExterior())
-        {
-            if (c->cell.mData.mX == cellData.mData.mX && c->cell.mData.mY == cellData.mData.mY)
-                return true;
-        }
-        else if (c->cell.mName == cellData.mName)
-            return true;
 
-        return false;
-    });
+    // Currently we cannot compare by record ID because plugin lists can be loaded in different order,
+    // so exteriors are identified by their grid position and interiors by their name
+    Cell **cellEntry;
+    if (cellData.isExterior())
+        cellEntry = &exteriorCells[getGridKey(cellData.mData.mX, cellData.mData.mY)];
+    else
+        cellEntry = &interiorCells[Misc::StringUtils::lowerCase(cellData.mName)];
 
-    Cell *cell;
-    if (it == cells.end())
+    if (*cellEntry == nullptr)
     {
         LOG_APPEND(TimedLog::LOG_INFO, "- Adding %s to CellController", cellData.getDescription().c_str());
 
-        cell = new Cell(cellData);
-        cells.push_back(cell);
+        *cellEntry = new Cell(cellData);
+        cells.push_back(*cellEntry);
     }
     else
-    {
         LOG_APPEND(TimedLog::LOG_INFO, "- Found %s in CellController", cellData.getDescription().c_str());
-        cell = *it;
-    }
 
-    return cell;
+    return *cellEntry;
 }
 
 void CellController::removeCell(Cell *cell)
@@ -119,19 +106,21 @@ void CellController::removeCell(Cell *cell)
     if (cell == nullptr)
         return;
 
-    for (auto it = cells.begin(); it != cells.end();)
-    {
-        if (*it != nullptr && *it == cell)
-        {
-            Script::Call<Script::CallbackIdentity("OnCellDeletion")>(cell->getDescription().c_str());
-            LOG_APPEND(TimedLog::LOG_INFO, "- Removing %s from CellController", cell->getDescription().c_str());
+    auto it = find(cells.begin(), cells.end(), cell);
 
-            delete *it;
-            it = cells.erase(it);
-        }
-        else
-            ++it;
-    }
+    if (it == cells.end())
+        return;
+
+    Script::Call<Script::CallbackIdentity("OnCellDeletion")>(cell->getDescription().c_str());
+    LOG_APPEND(TimedLog::LOG_INFO, "- Removing %s from CellController", cell->getDescription().c_str());
+
+    if (cell->cell.isExterior())
+        exteriorCells.erase(getGridKey(cell->cell.mData.mX, cell->cell.mData.mY));
+    else
+        interiorCells.erase(Misc::StringUtils::lowerCase(cell->cell.mName));
+
+    cells.erase(it);
+    delete cell;
 }
 
 void CellController::deletePlayer(Player *player)
@@ -191,3 +180,8 @@ void CellController::update(Player *player)
         removeCell(cell);
     }
 }
+
+uint64_t CellController::getGridKey(int x, int y)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
@@ -3,6 +3,7 @@
 
 #include <deque>
 #include <string>
+#include <unordered_map>
 #include <components/esm/records.hpp>
 #include <components/openmw-mp/Base/BaseObject.hpp>
 #include <components/openmw-mp/Packets/Actor/ActorPacket.hpp>
@@ -39,8 +40,15 @@ public:
     void update(Player *player);
 
 private:
+    static uint64_t getGridKey(int x, int y);
+
     static CellController *sThis;
     TContainer cells;
+
+    // Lookup tables for the cells above, with exteriors keyed by their grid position and
+    // interiors keyed by their lowercase name
+    std::unordered_map<uint64_t, Cell*> exteriorCells;
+    std::unordered_map<std::string, Cell*> interiorCells;
 };
 
 #endif //OPENMW_SERVERCELLCONTROLLER_HPP
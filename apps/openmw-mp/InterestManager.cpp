@@ -0,0 +1,163 @@
+#include "InterestManager.hpp"
+
+#include <cmath>
+
+#include <components/misc/stringops.hpp>
+#include <components/openmw-mp/NetworkMessages.hpp>
+#include <components/openmw-mp/TimedLog.hpp>
+
+#include "Player.hpp"
+#include "Utils.hpp"
+
+using namespace std;
+
+bool InterestManager::enabled = false;
+unordered_map<unsigned char, InterestManager::Relevance> InterestManager::relevances;
+unordered_map<uint64_t, chrono::steady_clock::time_point> InterestManager::lastSendTimes;
+
+// Packets that can be filtered by distance, under the names used for them in the server config
+static const pair<const char*, unsigned char> filterablePackets[] = {
+    {"playerPosition", ID_PLAYER_POSITION}
+};
+
+void InterestManager::setEnabled(bool state)
+{
+    enabled = state;
+}
+
+void InterestManager::setRelevance(unsigned char packetID, const Relevance &relevance)
+{
+    relevances[packetID] = relevance;
+}
+
+bool InterestManager::loadRelevance(const string &packetName, const string &value)
+{
+    for (const auto &filterablePacket : filterablePackets)
+    {
+        if (packetName != filterablePacket.first)
+            continue;
+
+        vector<string> values = Utils::split(value, ',');
+
+        if (values.size() != 3)
+            break;
+
+        try
+        {
+            Relevance relevance;
+            relevance.nearDistance = stof(values[0]);
+            relevance.cutoffDistance = stof(values[1]);
+            relevance.maxIntervalMsec = (unsigned int) stoul(values[2]);
+
+            if (relevance.cutoffDistance <= relevance.nearDistance)
+                break;
+
+            setRelevance(filterablePacket.second, relevance);
+            return true;
+        }
+        catch (const exception &)
+        {
+            break;
+        }
+    }
+
+    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Ignoring invalid interest management setting %s = %s",
+        packetName.c_str(), value.c_str());
+    return false;
+}
+
+bool InterestManager::isRelevant(Player *source, Player *target, unsigned char packetID)
+{
+    if (!enabled)
+        return true;
+
+    auto relevanceIt = relevances.find(packetID);
+
+    if (relevanceIt == relevances.end())
+        return true;
+
+    float distanceSquared;
+
+    if (!getDistanceSquared(source, target, distanceSquared))
+        return true;
+
+    const Relevance &relevance = relevanceIt->second;
+
+    if (distanceSquared <= relevance.nearDistance * relevance.nearDistance)
+        return true;
+
+    if (distanceSquared > relevance.cutoffDistance * relevance.cutoffDistance)
+        return false;
+
+    float distanceRatio = (sqrt(distanceSquared) - relevance.nearDistance) /
+        (relevance.cutoffDistance - relevance.nearDistance);
+    chrono::milliseconds interval((long long) (distanceRatio * relevance.maxIntervalMsec));
+
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    auto &lastSendTime = lastSendTimes[getSendKey(source->getId(), target->getId(), packetID)];
+
+    if (now - lastSendTime < interval)
+        return false;
+
+    lastSendTime = now;
+    return true;
+}
+
+bool InterestManager::isInRange(Player *source, Player *target, unsigned char packetID)
+{
+    if (!enabled)
+        return true;
+
+    auto relevanceIt = relevances.find(packetID);
+
+    if (relevanceIt == relevances.end())
+        return true;
+
+    float distanceSquared;
+
+    if (!getDistanceSquared(source, target, distanceSquared))
+        return true;
+
+    const Relevance &relevance = relevanceIt->second;
+    return distanceSquared <= relevance.cutoffDistance * relevance.cutoffDistance;
+}
+
+void InterestManager::removePlayer(unsigned short id)
+{
+    for (auto it = lastSendTimes.begin(); it != lastSendTimes.end();)
+    {
+        unsigned short sourceId = (unsigned short) (it->first >> 24);
+        unsigned short targetId = (unsigned short) (it->first >> 8);
+
+        if (sourceId == id || targetId == id)
+            it = lastSendTimes.erase(it);
+        else
+            ++it;
+    }
+}
+
+bool InterestManager::getDistanceSquared(Player *source, Player *target, float &distanceSquared)
+{
+    // Distances are only meaningful within the same worldspace, and players who share a loaded cell
+    // from different worldspaces are in the middle of a cell transition
+    if (source->cell.isExterior() != target->cell.isExterior())
+        return false;
+
+    if (!source->cell.isExterior() && !Misc::StringUtils::ciEqual(source->cell.mName, target->cell.mName))
+        return false;
+
+    distanceSquared = 0;
+
+    for (int i = 0; i < 3; i++)
+    {
+        float difference = source->position.pos[i] - target->position.pos[i];
+        distanceSquared += difference * difference;
+    }
+
+    return true;
+}
+
+uint64_t InterestManager::getSendKey(unsigned short sourceId, unsigned short targetId, unsigned char packetID)
+{
+    return (static_cast<uint64_t>(sourceId) << 24) | (static_cast<uint64_t>(targetId) << 8) | packetID;
+}
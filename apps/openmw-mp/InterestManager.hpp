@@ -0,0 +1,56 @@
+#ifndef OPENMW_INTERESTMANAGER_HPP
+#define OPENMW_INTERESTMANAGER_HPP
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
+class Player;
+
+/*
+    Decides whether a packet about one player is worth sending to another based on the distance
+    between them, so that players far away receive fewer updates and players beyond a cutoff
+    distance receive none
+
+    Only packets registered here are filtered, and only packets that always carry a player's
+    complete current state should be, because any of them can be skipped.
+*/
+class InterestManager
+{
+public:
+    struct Relevance
+    {
+        // Up to this distance, every packet is sent
+        float nearDistance;
+        // Beyond this distance, no packets are sent
+        float cutoffDistance;
+        // The time between two sent packets grows linearly up to this value at the cutoff distance
+        unsigned int maxIntervalMsec;
+    };
+
+    static void setEnabled(bool state);
+    static void setRelevance(unsigned char packetID, const Relevance &relevance);
+
+    // Parse a "nearDistance, cutoffDistance, maxIntervalMsec" setting for a packet by its setting name
+    static bool loadRelevance(const std::string &packetName, const std::string &value);
+
+    static bool isRelevant(Player *source, Player *target, unsigned char packetID);
+
+    // Whether the target is within the cutoff distance of the source, in which case packets about the
+    // source still reach it, even if not all of them
+    static bool isInRange(Player *source, Player *target, unsigned char packetID);
+
+    static void removePlayer(unsigned short id);
+
+private:
+    // Returns false if the distance between the players says nothing about their relevance to each other
+    static bool getDistanceSquared(Player *source, Player *target, float &distanceSquared);
+
+    static uint64_t getSendKey(unsigned short sourceId, unsigned short targetId, unsigned char packetID);
+
+    static bool enabled;
+    static std::unordered_map<unsigned char, Relevance> relevances;
+    static std::unordered_map<uint64_t, std::chrono::steady_clock::time_point> lastSendTimes;
+};
+
+#endif //OPENMW_INTERESTMANAGER_HPP
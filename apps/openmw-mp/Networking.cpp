@@ -8,6 +8,8 @@
 #include <components/openmw-mp/TimedLog.hpp>
 #include <components/openmw-mp/Version.hpp>
 #include <components/openmw-mp/Packets/PacketPreInit.hpp>
+#include <components/openmw-mp/Packets/Actor/PacketActorPosition.hpp>
+#include <components/openmw-mp/Packets/Player/PacketPlayerPosition.hpp>
 
 #include <iostream>
 #include <Script/Script.hpp>
@@ -19,6 +21,7 @@
 #include "MasterClient.hpp"
 #include "Cell.hpp"
 #include "CellController.hpp"
+#include "PacketProfiler.hpp"
 #include "processors/PlayerProcessor.hpp"
 #include "processors/ActorProcessor.hpp"
 #include "processors/ObjectProcessor.hpp"
@@ -33,7 +36,7 @@ static int currentMpNum = 0;
 static bool dataFileEnforcementState = true;
 static bool scriptErrorIgnoringState = false;
 
-Networking::Networking(RakNet::RakPeerInterface *peer) : mclient(nullptr)
+Networking::Networking(RakNet::RakPeerInterface *peer) : mclient(nullptr), packetDecoder(peer, tickScheduler)
 {
     sThis = this;
     this->peer = peer;
@@ -62,12 +65,18 @@ Networking::Networking(RakNet::RakPeerInterface *peer) : mclient(nullptr)
     serverPassword = TES3MP_DEFAULT_PASSW;
 
     ProcessorInitializer();
+
+    peer->SetIncomingDatagramEventHandler(&Networking::onIncomingDatagram);
 }
 
 Networking::~Networking()
 {
     Script::Call<Script::CallbackIdentity("OnServerExit")>(false);
 
+    peer->SetIncomingDatagramEventHandler(nullptr);
+
+    packetDecoder.stop();
+
     CellController::destroy();
 
     sThis = 0;
@@ -332,6 +341,124 @@ void Networking::update(RakNet::Packet *packet, RakNet::BitStream &bsIn)
         LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Unhandled RakNet packet with identifier %i has arrived", packet->data[0]);
 }
 
+void Networking::processPacket(RakNet::Packet *packet)
+{
+    switch (packet->data[0])
+    {
+        case ID_REMOTE_DISCONNECTION_NOTIFICATION:
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has disconnected", packet->systemAddress.ToString());
+            break;
+        case ID_REMOTE_CONNECTION_LOST:
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has lost connection", packet->systemAddress.ToString());
+            break;
+        case ID_REMOTE_NEW_INCOMING_CONNECTION:
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has connected", packet->systemAddress.ToString());
+            break;
+        case ID_CONNECTION_REQUEST_ACCEPTED:    // client to server
+        {
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Our connection request has been accepted");
+            break;
+        }
+        case ID_NEW_INCOMING_CONNECTION:
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "A connection is incoming from %s", packet->systemAddress.ToString());
+            break;
+        case ID_NO_FREE_INCOMING_CONNECTIONS:
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "The server is full");
+            break;
+        case ID_DISCONNECTION_NOTIFICATION:
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN,  "Client at %s has disconnected", packet->systemAddress.ToString());
+            disconnectPlayer(packet->guid);
+            break;
+        case ID_CONNECTION_LOST:
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has lost connection", packet->systemAddress.ToString());
+            disconnectPlayer(packet->guid);
+            break;
+        case ID_SND_RECEIPT_ACKED:
+        case ID_CONNECTED_PING:
+        case ID_UNCONNECTED_PING:
+            break;
+        default:
+        {
+            RakNet::BitStream bsIn(&packet->data[1], packet->length, false);
+            bsIn.IgnoreBytes((unsigned int) RakNet::RakNetGUID::size()); // Ignore GUID from received packet
+
+
+            if (Players::doesPlayerExist(packet->guid))
+                update(packet, bsIn);
+            else
+                preInit(packet, bsIn);
+            break;
+        }
+    }
+}
+
+void Networking::processDecodedPacket(PacketDecoder::Job &job)
+{
+    RakNet::Packet *packet = job.packet;
+    Player *player = Players::getPlayer(packet->guid);
+
+    // The player may have been disconnected while the packet was being decoded
+    if (player == nullptr || !player->isHandshaked() || player->getLoadState() != Player::POSTLOADED)
+    {
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Dropped decoded packet with identifier %i from %s because %s",
+            packet->data[0], packet->systemAddress.ToString(),
+            player == nullptr ? "the player has disconnected" : "the player is no longer fully loaded");
+        return;
+    }
+
+    PacketProfiler::recordDecode(packet->data[0], job.decodeTime);
+
+    switch (job.type)
+    {
+        case PacketDecoder::ACTOR_LIST:
+        {
+            baseActorList = move(*job.actorList);
+
+            if (!job.isHandled || !ActorProcessor::Dispatch(*packet, baseActorList))
+                LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Unhandled ActorPacket with identifier %i has arrived", packet->data[0]);
+            break;
+        }
+        case PacketDecoder::OBJECT_LIST:
+        {
+            baseObjectList = move(*job.objectList);
+
+            if (!job.isHandled || !ObjectProcessor::Dispatch(*packet, baseObjectList))
+                LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Unhandled ObjectPacket with identifier %i has arrived", packet->data[0]);
+            break;
+        }
+        case PacketDecoder::PLAYER_INVENTORY:
+        {
+            player->inventoryChanges = move(*job.inventoryChanges);
+
+            if (!PlayerProcessor::Dispatch(*packet))
+                LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Unhandled PlayerPacket with identifier %i has arrived", packet->data[0]);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+PacketDecoder::JobType Networking::getDecodeType(RakNet::Packet *packet)
+{
+    Player *player = Players::getPlayer(packet->guid);
+
+    // Anything that could still change the state of a connection stays on the main thread
+    if (player == nullptr || !player->isHandshaked() || player->getLoadState() != Player::POSTLOADED)
+        return PacketDecoder::MAIN_THREAD;
+
+    RakNet::MessageID id = packet->data[0];
+
+    if (actorPacketController->ContainsPacket(id))
+        return PacketDecoder::ACTOR_LIST;
+    else if (objectPacketController->ContainsPacket(id))
+        return PacketDecoder::OBJECT_LIST;
+    else if (id == ID_PLAYER_INVENTORY)
+        return PacketDecoder::PLAYER_INVENTORY;
+
+    return PacketDecoder::MAIN_THREAD;
+}
+
 void Networking::newPlayer(RakNet::RakNetGUID guid)
 {
     playerPacketController->GetPacket(ID_PLAYER_BASEINFO)->RequestData(guid);
@@ -387,9 +514,26 @@ void Networking::disconnectPlayer(RakNet::RakNetGUID guid)
 
     playerPacketController->GetPacket(ID_USER_DISCONNECTED)->setPlayer(player);
     playerPacketController->GetPacket(ID_USER_DISCONNECTED)->Send(true);
+
+    playerPacketController->ForgetConnection(guid);
+    actorPacketController->ForgetConnection(guid);
+    objectPacketController->ForgetConnection(guid);
+
     Players::deletePlayer(guid);
 }
 
+void Networking::forgetActorPosition(RakNet::RakNetGUID guid, const BaseActor &actor) const
+{
+    static_cast<PacketActorPosition *>(actorPacketController->GetPacket(ID_ACTOR_POSITION))->forgetActor(guid,
+        actor.refNum, actor.mpNum);
+}
+
+void Networking::forgetPlayerPosition(RakNet::RakNetGUID guid, RakNet::RakNetGUID otherGuid) const
+{
+    static_cast<PacketPlayerPosition *>(playerPacketController->GetPacket(ID_PLAYER_POSITION))->forgetPlayer(guid,
+        otherGuid);
+}
+
 PlayerPacketController *Networking::getPlayerPacketController() const
 {
     return playerPacketController;
@@ -492,67 +636,67 @@ int Networking::mainLoop()
     {
         if (kbhit() && getch() == '\n')
             break;
-        for (packet=peer->Receive(); packet; peer->DeallocatePacket(packet), packet=peer->Receive())
+
+        tickScheduler.beginTick();
+
+        for (packet = peer->Receive(); packet; packet = peer->Receive())
         {
-            if (getMasterClient()->Process(packet))
-                continue;
+            tickScheduler.onPacketReceived();
 
-            switch (packet->data[0])
+            if (getMasterClient()->Process(packet))
             {
-                case ID_REMOTE_DISCONNECTION_NOTIFICATION:
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has disconnected", packet->systemAddress.ToString());
-                    break;
-                case ID_REMOTE_CONNECTION_LOST:
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has lost connection", packet->systemAddress.ToString());
-                    break;
-                case ID_REMOTE_NEW_INCOMING_CONNECTION:
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has connected", packet->systemAddress.ToString());
-                    break;
-                case ID_CONNECTION_REQUEST_ACCEPTED:    // client to server
-                {
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Our connection request has been accepted");
-                    break;
-                }
-                case ID_NEW_INCOMING_CONNECTION:
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "A connection is incoming from %s", packet->systemAddress.ToString());
-                    break;
-                case ID_NO_FREE_INCOMING_CONNECTIONS:
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "The server is full");
-                    break;
-                case ID_DISCONNECTION_NOTIFICATION:
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN,  "Client at %s has disconnected", packet->systemAddress.ToString());
-                    disconnectPlayer(packet->guid);
-                    break;
-                case ID_CONNECTION_LOST:
-                    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Client at %s has lost connection", packet->systemAddress.ToString());
-                    disconnectPlayer(packet->guid);
-                    break;
-                case ID_SND_RECEIPT_ACKED:
-                case ID_CONNECTED_PING:
-                case ID_UNCONNECTED_PING:
-                    break;
-                default:
-                {
-                    RakNet::BitStream bsIn(&packet->data[1], packet->length, false);
-                    bsIn.IgnoreBytes((unsigned int) RakNet::RakNetGUID::size()); // Ignore GUID from received packet
+                peer->DeallocatePacket(packet);
+                continue;
+            }
 
+            PacketProfiler::recordReceived(packet->data[0], packet->length);
 
-                    if (Players::doesPlayerExist(packet->guid))
-                        update(packet, bsIn);
-                    else
-                        preInit(packet, bsIn);
-                    break;
-                }
+            if (packetDecoder.isEnabled())
+                packetDecoder.push(packet, getDecodeType(packet));
+            else
+            {
+                processPacket(packet);
+                peer->DeallocatePacket(packet);
             }
         }
+
+        packetDecoder.dispatch([this](PacketDecoder::Job &job) {
+            if (job.type == PacketDecoder::MAIN_THREAD)
+                processPacket(job.packet);
+            else
+                processDecodedPacket(job);
+        });
+
         TimerAPI::Tick();
-        this_thread::sleep_for(chrono::milliseconds(1));
+        PacketProfiler::update();
+
+        tickScheduler.endTick();
+        tickScheduler.wait(TimerAPI::GetMsecUntilNextTimer());
     }
 
     TimerAPI::Terminate();
     return exitCode;
 }
 
+TickScheduler &Networking::getTickScheduler()
+{
+    return tickScheduler;
+}
+
+PacketDecoder &Networking::getPacketDecoder()
+{
+    return packetDecoder;
+}
+
+bool Networking::onIncomingDatagram(RakNet::RNS2RecvStruct *recvStruct)
+{
+    // This runs on RakNet's receiving thread, so only wake up the main loop and let RakNet keep the datagram
+    if (sThis != nullptr)
+        sThis->tickScheduler.notify();
+
+    return true;
+}
+
 void Networking::kickPlayer(RakNet::RakNetGUID guid, bool sendNotification)
 {
     peer->CloseConnection(guid, sendNotification);
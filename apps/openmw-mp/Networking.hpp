@@ -8,8 +8,16 @@
 #include <components/openmw-mp/Controllers/WorldstatePacketController.hpp>
 #include <components/openmw-mp/Packets/PacketPreInit.hpp>
 #include "Player.hpp"
+#include "TickScheduler.hpp"
+#include "PacketDecoder.hpp"
 
 class MasterClient;
+
+namespace RakNet
+{
+    struct RNS2RecvStruct;
+}
+
 namespace  mwmp
 {
     class Networking
@@ -21,6 +29,10 @@ namespace  mwmp
         void newPlayer(RakNet::RakNetGUID guid);
         void disconnectPlayer(RakNet::RakNetGUID guid);
         void kickPlayer(RakNet::RakNetGUID guid, bool sendNotification = true);
+
+        // Drop the delta-encoding state kept for positions a player no longer receives
+        void forgetActorPosition(RakNet::RakNetGUID guid, const BaseActor &actor) const;
+        void forgetPlayerPosition(RakNet::RakNetGUID guid, RakNet::RakNetGUID otherGuid) const;
         
         void banAddress(const char *ipAddress);
         void unbanAddress(const char *ipAddress);
@@ -33,6 +45,10 @@ namespace  mwmp
         void processWorldstatePacket(RakNet::Packet *packet);
         void update(RakNet::Packet *packet, RakNet::BitStream &bsIn);
 
+        void processPacket(RakNet::Packet *packet);
+        void processDecodedPacket(PacketDecoder::Job &job);
+        PacketDecoder::JobType getDecodeType(RakNet::Packet *packet);
+
         unsigned short numberOfConnections() const;
         unsigned int maxConnections() const;
         int getAvgPing(RakNet::AddressOrGUID) const;
@@ -40,6 +56,9 @@ namespace  mwmp
 
         int mainLoop();
 
+        TickScheduler &getTickScheduler();
+        PacketDecoder &getPacketDecoder();
+
         void stopServer(int code);
 
         SystemPacketController *getSystemPacketController() const;
@@ -75,6 +94,7 @@ namespace  mwmp
         PacketPreInit::PluginContainer &getSamples();
     private:
         bool preInit(RakNet::Packet *packet, RakNet::BitStream &bsIn);
+        static bool onIncomingDatagram(RakNet::RNS2RecvStruct *recvStruct);
         std::string serverPassword;
         static Networking *sThis;
 
@@ -94,6 +114,9 @@ namespace  mwmp
         ObjectPacketController *objectPacketController;
         WorldstatePacketController *worldstatePacketController;
 
+        TickScheduler tickScheduler;
+        PacketDecoder packetDecoder;
+
         bool running;
         int exitCode;
         PacketPreInit::PluginContainer samples;
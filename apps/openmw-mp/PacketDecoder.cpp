@@ -0,0 +1,217 @@
+#include "PacketDecoder.hpp"
+
+#include <unordered_set>
+
+#include <components/openmw-mp/TimedLog.hpp>
+
+#include "processors/ActorProcessor.hpp"
+#include "processors/ObjectProcessor.hpp"
+
+using namespace mwmp;
+using namespace std;
+
+PacketDecoder::Worker::Worker(RakNet::RakPeerInterface *peer) : actorPacketController(peer),
+    objectPacketController(peer), inventoryPacket(peer)
+{
+
+}
+
+PacketDecoder::PacketDecoder(RakNet::RakPeerInterface *peer, TickScheduler &tickScheduler) : peer(peer),
+    tickScheduler(tickScheduler), isStopping(false)
+{
+
+}
+
+PacketDecoder::~PacketDecoder()
+{
+    stop();
+
+    for (auto &job : pendingJobs)
+        peer->DeallocatePacket(job->packet);
+}
+
+void PacketDecoder::start(unsigned int threadCount)
+{
+    stop();
+
+    isStopping = false;
+
+    for (unsigned int i = 0; i < threadCount; i++)
+    {
+        workers.emplace_back(new Worker(peer));
+        Worker &worker = *workers.back();
+        worker.thread = thread(&PacketDecoder::runWorker, this, ref(worker));
+    }
+
+    if (threadCount > 0)
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Decoding actor, object and inventory packets on %u threads", threadCount);
+}
+
+void PacketDecoder::stop()
+{
+    isStopping = true;
+
+    for (auto &worker : workers)
+    {
+        {
+            lock_guard<mutex> lock(worker->mutex);
+            worker->jobs.clear();
+        }
+
+        worker->condition.notify_one();
+        worker->thread.join();
+    }
+
+    workers.clear();
+
+    // Jobs that never got decoded are now handled like every other packet on the main thread
+    for (auto &job : pendingJobs)
+    {
+        if (!job->isDecoded)
+        {
+            job->type = MAIN_THREAD;
+            job->isDecoded = true;
+        }
+    }
+}
+
+bool PacketDecoder::isEnabled() const
+{
+    return !workers.empty();
+}
+
+void PacketDecoder::push(RakNet::Packet *packet, JobType type)
+{
+    Job *job = new Job;
+    job->packet = packet;
+    job->type = isEnabled() ? type : MAIN_THREAD;
+    job->isHandled = false;
+    job->decodeTime = PacketProfiler::Clock::duration::zero();
+
+    pendingJobs.emplace_back(job);
+
+    if (job->type == MAIN_THREAD)
+    {
+        job->isDecoded = true;
+        return;
+    }
+
+    job->isDecoded = false;
+
+    switch (job->type)
+    {
+        case ACTOR_LIST:
+            job->actorList.reset(new BaseActorList);
+            break;
+        case OBJECT_LIST:
+            job->objectList.reset(new BaseObjectList);
+            break;
+        case PLAYER_INVENTORY:
+            job->inventoryChanges.reset(new InventoryChanges);
+            break;
+        default:
+            break;
+    }
+
+    // Keep every client on the same worker so its packets are decoded in the order they arrived
+    Worker &worker = *workers[packet->guid.g % workers.size()];
+
+    {
+        lock_guard<mutex> lock(worker.mutex);
+        worker.jobs.push_back(job);
+    }
+
+    worker.condition.notify_one();
+}
+
+void PacketDecoder::dispatch(const function<void(Job &job)> &callback)
+{
+    unordered_set<uint64_t> blockedClients;
+
+    for (auto it = pendingJobs.begin(); it != pendingJobs.end();)
+    {
+        Job &job = **it;
+        uint64_t client = job.packet->guid.g;
+
+        if (!blockedClients.empty() && blockedClients.count(client) != 0)
+        {
+            ++it;
+            continue;
+        }
+
+        if (!job.isDecoded.load(memory_order_acquire))
+        {
+            blockedClients.insert(client);
+            ++it;
+            continue;
+        }
+
+        callback(job);
+
+        peer->DeallocatePacket(job.packet);
+        it = pendingJobs.erase(it);
+    }
+}
+
+size_t PacketDecoder::getPendingCount() const
+{
+    return pendingJobs.size();
+}
+
+void PacketDecoder::runWorker(Worker &worker)
+{
+    while (true)
+    {
+        Job *job;
+
+        {
+            unique_lock<mutex> lock(worker.mutex);
+            worker.condition.wait(lock, [&]() { return isStopping || !worker.jobs.empty(); });
+
+            if (isStopping)
+                return;
+
+            job = worker.jobs.front();
+            worker.jobs.pop_front();
+        }
+
+        decode(worker, *job);
+        job->isDecoded.store(true, memory_order_release);
+
+        tickScheduler.notify();
+    }
+}
+
+void PacketDecoder::decode(Worker &worker, Job &job)
+{
+    RakNet::Packet &packet = *job.packet;
+    PacketProfiler::Clock::time_point decodeStart = PacketProfiler::Clock::now();
+
+    RakNet::BitStream bsIn(&packet.data[1], packet.length, false);
+    bsIn.IgnoreBytes((unsigned int) RakNet::RakNetGUID::size()); // Ignore GUID from received packet
+
+    switch (job.type)
+    {
+        case ACTOR_LIST:
+            worker.actorPacketController.SetStream(&bsIn, nullptr);
+            job.isHandled = ActorProcessor::Decode(packet, worker.actorPacketController, *job.actorList);
+            break;
+        case OBJECT_LIST:
+            worker.objectPacketController.SetStream(&bsIn, nullptr);
+            job.isHandled = ObjectProcessor::Decode(packet, worker.objectPacketController, *job.objectList);
+            break;
+        case PLAYER_INVENTORY:
+            worker.scratchPlayer.guid = packet.guid;
+            worker.inventoryPacket.SetStreams(&bsIn, nullptr);
+            worker.inventoryPacket.setPlayer(&worker.scratchPlayer);
+            worker.inventoryPacket.Read();
+
+            *job.inventoryChanges = move(worker.scratchPlayer.inventoryChanges);
+            job.isHandled = true;
+            break;
+        default:
+            break;
+    }
+
+    job.decodeTime = PacketProfiler::Clock::now() - decodeStart;
+}
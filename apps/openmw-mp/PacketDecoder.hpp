@@ -0,0 +1,109 @@
+#ifndef OPENMW_PACKETDECODER_HPP
+#define OPENMW_PACKETDECODER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <components/openmw-mp/Base/BaseActor.hpp>
+#include <components/openmw-mp/Base/BaseObject.hpp>
+#include <components/openmw-mp/Base/BasePlayer.hpp>
+#include <components/openmw-mp/Controllers/ActorPacketController.hpp>
+#include <components/openmw-mp/Controllers/ObjectPacketController.hpp>
+#include <components/openmw-mp/Packets/Player/PacketPlayerInventory.hpp>
+
+#include "PacketProfiler.hpp"
+#include "TickScheduler.hpp"
+
+namespace mwmp
+{
+    /*
+        Decodes received actor, object and inventory packets on a pool of worker threads, so a large
+        packet from one client does not hold up the packets of every other client
+
+        Every received packet becomes a job that the main thread dispatches in arrival order, except
+        that a job still being decoded holds back the later jobs of its own client until it is done.
+        Each client is always decoded by the same worker, using that worker's own packet instances.
+    */
+    class PacketDecoder
+    {
+    public:
+        enum JobType
+        {
+            // Processed entirely on the main thread, as packets were before
+            MAIN_THREAD,
+            ACTOR_LIST,
+            OBJECT_LIST,
+            PLAYER_INVENTORY
+        };
+
+        struct Job
+        {
+            RakNet::Packet *packet;
+            JobType type;
+            std::atomic<bool> isDecoded;
+
+            // Whether a processor was found for the packet while decoding it
+            bool isHandled;
+            PacketProfiler::Clock::duration decodeTime;
+
+            std::unique_ptr<BaseActorList> actorList;
+            std::unique_ptr<BaseObjectList> objectList;
+            std::unique_ptr<InventoryChanges> inventoryChanges;
+        };
+
+        PacketDecoder(RakNet::RakPeerInterface *peer, TickScheduler &tickScheduler);
+        ~PacketDecoder();
+
+        // Start the given number of workers, with 0 keeping all decoding on the main thread
+        void start(unsigned int threadCount);
+        void stop();
+
+        bool isEnabled() const;
+
+        // Take over a received packet and start decoding it right away if its type allows it
+        void push(RakNet::Packet *packet, JobType type);
+
+        // Hand every job that is ready to the callback and deallocate its packet afterwards
+        void dispatch(const std::function<void(Job &job)> &callback);
+
+        size_t getPendingCount() const;
+
+    private:
+        struct Worker
+        {
+            Worker(RakNet::RakPeerInterface *peer);
+
+            std::thread thread;
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::deque<Job *> jobs;
+
+            // The client never writes indexed strings or position deltas, so the per-connection
+            // state of these packets stays empty and never needs to be forgotten
+            ActorPacketController actorPacketController;
+            ObjectPacketController objectPacketController;
+            PacketPlayerInventory inventoryPacket;
+            BasePlayer scratchPlayer;
+        };
+
+        void runWorker(Worker &worker);
+        void decode(Worker &worker, Job &job);
+
+        RakNet::RakPeerInterface *peer;
+        TickScheduler &tickScheduler;
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<bool> isStopping;
+
+        std::list<std::unique_ptr<Job>> pendingJobs;
+    };
+}
+
+#endif //OPENMW_PACKETDECODER_HPP
@@ -0,0 +1,270 @@
+#include "PacketProfiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include <components/openmw-mp/TimedLog.hpp>
+#include <components/openmw-mp/Packets/BasePacket.hpp>
+
+using namespace std;
+
+// The number of packet IDs listed in each logged summary
+static const unsigned int summaryLength = 10;
+
+bool PacketProfiler::enabled = false;
+int PacketProfiler::currentPacketID = -1;
+
+PacketProfiler::Clock::duration PacketProfiler::summaryInterval = chrono::seconds(60);
+PacketProfiler::Clock::time_point PacketProfiler::nextSummary = PacketProfiler::Clock::now() + chrono::seconds(60);
+PacketProfiler::Clock::time_point PacketProfiler::resetTime = PacketProfiler::Clock::now();
+string PacketProfiler::statsFile;
+
+string PacketProfiler::packetNames[256];
+
+PacketProfiler::PacketStats PacketProfiler::totalStats[256] = {};
+PacketProfiler::PacketStats PacketProfiler::intervalStats[256] = {};
+PacketProfiler::Clock::duration PacketProfiler::totalOtherScriptTime = PacketProfiler::Clock::duration::zero();
+PacketProfiler::Clock::duration PacketProfiler::intervalOtherScriptTime = PacketProfiler::Clock::duration::zero();
+
+uint64_t PacketProfiler::collectedSentCount[256] = {};
+uint64_t PacketProfiler::collectedBytesSent[256] = {};
+
+PacketProfiler::ProcessScope::ProcessScope(unsigned char packetID, const string &packetName) : isActive(enabled),
+    packetID(packetID), previousPacketID(currentPacketID)
+{
+    if (!isActive)
+        return;
+
+    if (packetNames[packetID].empty())
+        packetNames[packetID] = packetName;
+
+    currentPacketID = packetID;
+    startTime = Clock::now();
+}
+
+PacketProfiler::ProcessScope::~ProcessScope()
+{
+    if (!isActive)
+        return;
+
+    Clock::duration time = Clock::now() - startTime;
+    totalStats[packetID].processTime += time;
+    intervalStats[packetID].processTime += time;
+
+    currentPacketID = previousPacketID;
+}
+
+void PacketProfiler::setEnabled(bool state)
+{
+    enabled = state;
+}
+
+bool PacketProfiler::isEnabled()
+{
+    return enabled;
+}
+
+void PacketProfiler::setSummaryInterval(unsigned int seconds)
+{
+    summaryInterval = chrono::seconds(max(seconds, 1u));
+    nextSummary = Clock::now() + summaryInterval;
+}
+
+void PacketProfiler::setStatsFile(const string &path)
+{
+    statsFile = path;
+}
+
+void PacketProfiler::recordReceived(unsigned char packetID, unsigned int bytes)
+{
+    if (!enabled)
+        return;
+
+    totalStats[packetID].receivedCount++;
+    totalStats[packetID].bytesReceived += bytes;
+    intervalStats[packetID].receivedCount++;
+    intervalStats[packetID].bytesReceived += bytes;
+}
+
+void PacketProfiler::recordDecode(unsigned char packetID, Clock::duration time)
+{
+    if (!enabled)
+        return;
+
+    totalStats[packetID].decodeTime += time;
+    intervalStats[packetID].decodeTime += time;
+}
+
+void PacketProfiler::recordScript(Clock::duration time)
+{
+    if (!enabled)
+        return;
+
+    if (currentPacketID < 0)
+    {
+        totalOtherScriptTime += time;
+        intervalOtherScriptTime += time;
+        return;
+    }
+
+    totalStats[currentPacketID].scriptTime += time;
+    intervalStats[currentPacketID].scriptTime += time;
+}
+
+void PacketProfiler::update()
+{
+    if (!enabled)
+        return;
+
+    Clock::time_point now = Clock::now();
+
+    if (now < nextSummary)
+        return;
+
+    nextSummary = now + summaryInterval;
+
+    collectSent();
+    logSummary();
+
+    if (!statsFile.empty())
+        writeStatsFile();
+
+    for (auto &stats : intervalStats)
+        stats = PacketStats();
+
+    intervalOtherScriptTime = Clock::duration::zero();
+}
+
+PacketProfiler::PacketStats PacketProfiler::getStats(unsigned char packetID)
+{
+    collectSent();
+    return totalStats[packetID];
+}
+
+double PacketProfiler::getOtherScriptMsec()
+{
+    return toMsec(totalOtherScriptTime);
+}
+
+string PacketProfiler::getJson()
+{
+    collectSent();
+
+    string json;
+    char buffer[512];
+
+    snprintf(buffer, sizeof(buffer), "{\"seconds\":%.3f,\"otherScriptMsec\":%.3f,\"packets\":[",
+        chrono::duration<double>(Clock::now() - resetTime).count(), toMsec(totalOtherScriptTime));
+    json += buffer;
+
+    bool isFirst = true;
+
+    for (unsigned int id = 0; id < 256; id++)
+    {
+        const PacketStats &stats = totalStats[id];
+
+        if (stats.receivedCount == 0 && stats.sentCount == 0)
+            continue;
+
+        // Packet names come from processor identifiers, so they never need escaping
+        snprintf(buffer, sizeof(buffer), "%s{\"id\":%u,\"name\":\"%s\",\"received\":%llu,\"bytesReceived\":%llu,"
+            "\"sent\":%llu,\"bytesSent\":%llu,\"decodeMsec\":%.3f,\"processMsec\":%.3f,\"scriptMsec\":%.3f}",
+            isFirst ? "" : ",", id, packetNames[id].c_str(), (unsigned long long) stats.receivedCount,
+            (unsigned long long) stats.bytesReceived, (unsigned long long) stats.sentCount,
+            (unsigned long long) stats.bytesSent, toMsec(stats.decodeTime), toMsec(stats.processTime),
+            toMsec(stats.scriptTime));
+        json += buffer;
+
+        isFirst = false;
+    }
+
+    json += "]}";
+    return json;
+}
+
+void PacketProfiler::reset()
+{
+    collectSent();
+
+    for (auto &stats : totalStats)
+        stats = PacketStats();
+
+    totalOtherScriptTime = Clock::duration::zero();
+    resetTime = Clock::now();
+}
+
+void PacketProfiler::collectSent()
+{
+    for (unsigned int id = 0; id < 256; id++)
+    {
+        uint64_t sentCount = mwmp::BasePacket::getSentCount((RakNet::MessageID) id);
+        uint64_t bytesSent = mwmp::BasePacket::getBytesSent((RakNet::MessageID) id);
+
+        totalStats[id].sentCount += sentCount - collectedSentCount[id];
+        totalStats[id].bytesSent += bytesSent - collectedBytesSent[id];
+        intervalStats[id].sentCount += sentCount - collectedSentCount[id];
+        intervalStats[id].bytesSent += bytesSent - collectedBytesSent[id];
+
+        collectedSentCount[id] = sentCount;
+        collectedBytesSent[id] = bytesSent;
+    }
+}
+
+void PacketProfiler::logSummary()
+{
+    vector<unsigned int> ids;
+
+    for (unsigned int id = 0; id < 256; id++)
+    {
+        if (intervalStats[id].receivedCount != 0 || intervalStats[id].sentCount != 0)
+            ids.push_back(id);
+    }
+
+    // List the packets whose handling took the most time first
+    sort(ids.begin(), ids.end(), [](unsigned int a, unsigned int b) {
+        return intervalStats[a].decodeTime + intervalStats[a].processTime >
+            intervalStats[b].decodeTime + intervalStats[b].processTime;
+    });
+
+    LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Packet profile for the last %lld seconds, %.3f ms of scripts outside packets:",
+        (long long) chrono::duration_cast<chrono::seconds>(summaryInterval).count(), toMsec(intervalOtherScriptTime));
+
+    for (unsigned int i = 0; i < ids.size() && i < summaryLength; i++)
+    {
+        const PacketStats &stats = intervalStats[ids[i]];
+        const char *name = packetNames[ids[i]].empty() ? "unprocessed" : packetNames[ids[i]].c_str();
+
+        LOG_APPEND(TimedLog::LOG_INFO, "- %u %s: in %llu (%llu bytes), out %llu (%llu bytes), decode %.3f ms, process %.3f ms, scripts %.3f ms",
+            ids[i], name, (unsigned long long) stats.receivedCount, (unsigned long long) stats.bytesReceived,
+            (unsigned long long) stats.sentCount, (unsigned long long) stats.bytesSent, toMsec(stats.decodeTime),
+            toMsec(stats.processTime), toMsec(stats.scriptTime));
+    }
+}
+
+void PacketProfiler::writeStatsFile()
+{
+    // Write to a temporary file first so readers never see a partially written one
+    string temporaryFile = statsFile + ".tmp";
+
+    {
+        ofstream file(temporaryFile, ios::trunc);
+
+        if (!file)
+        {
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Could not write packet profile to %s", statsFile.c_str());
+            return;
+        }
+
+        file << getJson() << '\n';
+    }
+
+    remove(statsFile.c_str());
+    rename(temporaryFile.c_str(), statsFile.c_str());
+}
+
+double PacketProfiler::toMsec(Clock::duration time)
+{
+    return chrono::duration<double, milli>(time).count();
+}
@@ -0,0 +1,97 @@
+#ifndef OPENMW_PACKETPROFILER_HPP
+#define OPENMW_PACKETPROFILER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+/*
+    Records how often each packet ID is received and sent, how many bytes that takes and how long
+    decoding, processing and the script callbacks run for each of them take
+
+    Script time spent outside of any packet, such as in timers, is kept separately. Everything here
+    is only touched by the main thread, with decode times from worker threads reported through it.
+*/
+class PacketProfiler
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    struct PacketStats
+    {
+        uint64_t receivedCount;
+        uint64_t bytesReceived;
+        uint64_t sentCount;
+        uint64_t bytesSent;
+        Clock::duration decodeTime;
+        Clock::duration processTime;
+        Clock::duration scriptTime;
+    };
+
+    // Measures a processor's work on a packet and attributes script time in the meantime to it
+    class ProcessScope
+    {
+    public:
+        ProcessScope(unsigned char packetID, const std::string &packetName);
+        ~ProcessScope();
+
+    private:
+        bool isActive;
+        unsigned char packetID;
+        int previousPacketID;
+        Clock::time_point startTime;
+    };
+
+    static void setEnabled(bool state);
+    static bool isEnabled();
+
+    static void setSummaryInterval(unsigned int seconds);
+
+    // Also write the complete statistics to this file as JSON every summary interval, so they can
+    // be looked at without going through the log
+    static void setStatsFile(const std::string &path);
+
+    static void recordReceived(unsigned char packetID, unsigned int bytes);
+    static void recordDecode(unsigned char packetID, Clock::duration time);
+    static void recordScript(Clock::duration time);
+
+    // Log a summary and write the statistics file once the summary interval has passed
+    static void update();
+
+    static PacketStats getStats(unsigned char packetID);
+    static double getOtherScriptMsec();
+
+    // Get every statistic since the server's startup or the last reset as a JSON object
+    static std::string getJson();
+
+    static void reset();
+
+private:
+    static void collectSent();
+    static void logSummary();
+    static void writeStatsFile();
+
+    static double toMsec(Clock::duration time);
+
+    static bool enabled;
+    static int currentPacketID;
+
+    static Clock::duration summaryInterval;
+    static Clock::time_point nextSummary;
+    static Clock::time_point resetTime;
+    static std::string statsFile;
+
+    static std::string packetNames[256];
+
+    // Totals since the last reset, and the part of them since the last summary
+    static PacketStats totalStats[256];
+    static PacketStats intervalStats[256];
+    static Clock::duration totalOtherScriptTime;
+    static Clock::duration intervalOtherScriptTime;
+
+    // BasePacket's counters of sent packets at the time they were last collected
+    static uint64_t collectedSentCount[256];
+    static uint64_t collectedBytesSent[256];
+};
+
+#endif //OPENMW_PACKETPROFILER_HPP
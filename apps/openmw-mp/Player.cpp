@@ -1,4 +1,8 @@
 #include "Player.hpp"
+
+#include <components/openmw-mp/NetworkMessages.hpp>
+
+#include "InterestManager.hpp"
 #include "Networking.hpp"
 
 TPlayers Players::players;
@@ -16,6 +20,7 @@ void Players::deletePlayer(RakNet::RakNetGUID guid)
 
         LOG_APPEND(TimedLog::LOG_INFO, "- Emptying slot %i", players[guid]->getId());
 
+        InterestManager::removePlayer(players[guid]->getId());
         slots[players[guid]->getId()] = 0;
         delete players[guid];
         players.erase(guid);
@@ -133,43 +138,69 @@ CellController::TContainer *Player::getCells()
 
 void Player::sendToLoaded(mwmp::PlayerPacket *myPacket)
 {
-    std::list <Player*> plList;
+    myPacket->setPlayer(this);
 
-    for (auto cell : cells)
-        for (auto pl : *cell)
-            plList.push_back(pl);
+    bool isSerialized = false;
 
-    plList.sort();
-    plList.unique();
-
-    for (auto pl : plList)
+    for (auto &visiblePlayer : visiblePlayers)
     {
-        if (pl == this) continue;
-        myPacket->setPlayer(this);
-        myPacket->Send(pl->guid);
+        Player *pl = visiblePlayer.first;
+
+        if (!InterestManager::isRelevant(this, pl, myPacket->GetPacketID()))
+        {
+            // A player who has moved out of range stops receiving our position until they are back in range
+            if (myPacket->GetPacketID() == ID_PLAYER_POSITION && !InterestManager::isInRange(this, pl, ID_PLAYER_POSITION))
+                mwmp::Networking::get().forgetPlayerPosition(pl->guid, guid);
+
+            continue;
+        }
+
+        if (myPacket->hasPerConnectionEncoding())
+        {
+            myPacket->Send(pl->guid);
+            continue;
+        }
+
+        // Only encode the packet once and reuse the same bytes for every other player
+        if (!isSerialized)
+        {
+            myPacket->Serialize();
+            isSerialized = true;
+        }
+
+        myPacket->SendSerialized(pl->guid);
     }
 }
 
 void Player::forEachLoaded(std::function<void(Player *pl, Player *other)> func)
 {
-    std::list <Player*> plList;
-
-    for (auto cell : cells)
+    for (auto &visiblePlayer : visiblePlayers)
     {
-        for (auto pl : *cell)
-        {
-            if (pl != nullptr && !pl->npc.mName.empty())
-                plList.push_back(pl);
-        }
+        Player *pl = visiblePlayer.first;
+
+        if (!pl->npc.mName.empty())
+            func(this, pl);
     }
+}
 
-    plList.sort();
-    plList.unique();
+void Player::addVisiblePlayer(Player *other)
+{
+    visiblePlayers[other]++;
+}
+
+void Player::removeVisiblePlayer(Player *other)
+{
+    auto it = visiblePlayers.find(other);
 
-    for (auto pl : plList)
+    if (it != visiblePlayers.end() && --it->second == 0)
     {
-        if (pl == this) continue;
-        func(this, pl);
+        visiblePlayers.erase(it);
+
+        // We no longer share a cell with the other player, so we stop receiving their position
+        mwmp::Networking *networking = mwmp::Networking::getPtr();
+
+        if (networking != nullptr)
+            networking->forgetPlayerPosition(guid, other->guid);
     }
 }
 
@@ -2,6 +2,7 @@
 #define OPENMW_PLAYER_HPP
 
 #include <map>
+#include <unordered_map>
 #include <string>
 #include <chrono>
 #include <RakNetTypes.h>
@@ -70,7 +71,15 @@ public:
     void forEachLoaded(std::function<void(Player *pl, Player *other)> func);
 
 private:
+    void addVisiblePlayer(Player *other);
+    void removeVisiblePlayer(Player *other);
+
     CellController::TContainer cells;
+
+    // Other players with at least one loaded cell in common with this one, mapped to
+    // the number of cells they share, as kept up to date by Cell::addPlayer() and
+    // Cell::removePlayer()
+    std::unordered_map<Player*, unsigned int> visiblePlayers;
     int loadState;
     int handshakeCounter;
 
@@ -1,8 +1,9 @@
 #include "TimerAPI.hpp"
 
 #include <chrono>
+#include <cmath>
 
-#include <iostream>
+#include <components/openmw-mp/TimedLog.hpp>
 using namespace mwmp;
 using namespace std;
 
@@ -11,6 +12,7 @@ Timer::Timer(ScriptFunc callback, long msec, const std::string& def, std::vector
     targetMsec = msec;
     this->args = args;
     isEnded = true;
+    generation = 0;
 }
 
 #if defined(ENABLE_LUA)
@@ -19,24 +21,10 @@ Timer::Timer(lua_State *lua, ScriptFuncLua callback, long msec, const std::strin
     targetMsec = msec;
     this->args = args;
     isEnded = true;
+    generation = 0;
 }
 #endif
 
-void Timer::Tick()
-{
-    if (isEnded)
-        return;
-
-    const auto duration = chrono::system_clock::now().time_since_epoch();
-    const auto time = chrono::duration_cast<chrono::milliseconds>(duration).count();
-
-    if (time - startTime >= targetMsec)
-    {
-        isEnded = true;
-        Call(args);
-    }
-}
-
 bool Timer::IsEnded()
 {
     return isEnded;
@@ -56,15 +44,24 @@ void Timer::Restart(int msec)
 void Timer::Start()
 {
     isEnded = false;
+    startTime = GetCurrentMsec();
+}
 
-    const auto duration = chrono::system_clock::now().time_since_epoch();
-    const auto msec = chrono::duration_cast<chrono::milliseconds>(duration).count();
-    startTime = msec;
+double Timer::GetCurrentMsec()
+{
+    const auto duration = chrono::steady_clock::now().time_since_epoch();
+    return chrono::duration<double, milli>(duration).count();
 }
 
 int TimerAPI::pointer = 0;
 std::unordered_map<int, Timer* > TimerAPI::timers;
 
+std::priority_queue<TimerAPI::ScheduledTimer, std::vector<TimerAPI::ScheduledTimer>,
+    std::greater<TimerAPI::ScheduledTimer>> TimerAPI::deadlines;
+unsigned long long TimerAPI::nextGeneration = 0;
+unsigned int TimerAPI::activeTimerCount = 0;
+unsigned long long TimerAPI::firedTimerCount = 0;
+
 #if defined(ENABLE_LUA)
 int TimerAPI::CreateTimerLua(lua_State *lua, ScriptFuncLua callback, long msec, const std::string& def, std::vector<boost::any> args)
 {
@@ -119,13 +116,16 @@ void TimerAPI::FreeTimer(int timerid)
     {
         if (timers.at(timerid) != nullptr)
         {
+            if (!timers[timerid]->IsEnded())
+                activeTimerCount--;
+
             delete timers[timerid];
             timers[timerid] = nullptr;
         }
     }
     catch(...)
     {
-        std::cerr << "Timer " << timerid << " not found!" << endl;
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Timer %i not found!", timerid);
     }
 }
 
@@ -133,11 +133,19 @@ void TimerAPI::ResetTimer(int timerid, long msec)
 {
     try
     {
-        timers.at(timerid)->Restart(msec);
+        Timer *timer = timers.at(timerid);
+        if (timer == nullptr)
+            throw 1;
+
+        if (timer->IsEnded())
+            activeTimerCount++;
+
+        timer->Restart(msec);
+        Schedule(timerid, timer);
     }
     catch(...)
     {
-        std::cerr << "Timer " << timerid << " not found!" << endl;
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Timer %i not found!", timerid);
     }
 }
 
@@ -148,11 +156,16 @@ void TimerAPI::StartTimer(int timerid)
         Timer *timer = timers.at(timerid);
         if (timer == nullptr)
             throw 1;
+
+        if (timer->IsEnded())
+            activeTimerCount++;
+
         timer->Start();
+        Schedule(timerid, timer);
     }
     catch(...)
     {
-        std::cerr << "Timer " << timerid << " not found!" << endl;
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Timer %i not found!", timerid);
     }
 }
 
@@ -160,11 +173,18 @@ void TimerAPI::StopTimer(int timerid)
 {
     try
     {
-        timers.at(timerid)->Stop();
+        Timer *timer = timers.at(timerid);
+        if (timer == nullptr)
+            throw 1;
+
+        if (!timer->IsEnded())
+            activeTimerCount--;
+
+        timer->Stop();
     }
     catch(...)
     {
-        std::cerr << "Timer " << timerid << " not found!" << endl;
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Timer %i not found!", timerid);
     }
 }
 
@@ -173,30 +193,118 @@ bool TimerAPI::IsTimerElapsed(int timerid)
     bool ret = false;
     try
     {
-        ret = timers.at(timerid)->IsEnded();
+        Timer *timer = timers.at(timerid);
+        if (timer == nullptr)
+            throw 1;
+
+        ret = timer->IsEnded();
     }
     catch(...)
     {
-        std::cerr << "Timer " << timerid << " not found!" << endl;
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Timer %i not found!", timerid);
     }
     return ret;
 }
 
 void TimerAPI::Terminate()
 {
-    for (auto timer : timers)
+    for (auto &timer : timers)
     {
         if (timer.second != nullptr)
             delete timer.second;
         timer.second = nullptr;
     }
+
+    deadlines = decltype(deadlines)();
+    activeTimerCount = 0;
 }
 
 void TimerAPI::Tick()
 {
-    for (auto timer : timers)
+    if (deadlines.empty())
+        return;
+
+    const double currentMsec = Timer::GetCurrentMsec();
+
+    // Take out every timer that is due before running any of them, so timers restarted from inside
+    // their own callbacks wait for the next tick instead of running again right away
+    std::vector<ScheduledTimer> dueTimers;
+
+    while (!deadlines.empty() && deadlines.top().deadline <= currentMsec)
     {
-        if (timer.second != nullptr)
-            timer.second->Tick();
+        dueTimers.push_back(deadlines.top());
+        deadlines.pop();
     }
+
+    for (const auto &scheduledTimer : dueTimers)
+    {
+        // Earlier callbacks may have stopped, restarted or freed this timer
+        if (!IsScheduled(scheduledTimer))
+            continue;
+
+        Timer *timer = timers[scheduledTimer.timerId];
+        timer->isEnded = true;
+        activeTimerCount--;
+        firedTimerCount++;
+
+        timer->Call(timer->args);
+    }
+
+    // Stopped and restarted timers leave stale entries behind, so drop them once they outnumber the live ones
+    if (deadlines.size() > 2 * activeTimerCount + 64)
+        DiscardStaleTimers();
+}
+
+long TimerAPI::GetMsecUntilNextTimer()
+{
+    while (!deadlines.empty() && !IsScheduled(deadlines.top()))
+        deadlines.pop();
+
+    if (deadlines.empty())
+        return -1;
+
+    const double msecRemaining = deadlines.top().deadline - Timer::GetCurrentMsec();
+
+    return msecRemaining > 0 ? static_cast<long>(ceil(msecRemaining)) : 0;
+}
+
+unsigned int TimerAPI::GetActiveTimerCount()
+{
+    return activeTimerCount;
+}
+
+unsigned long long TimerAPI::GetFiredTimerCount()
+{
+    return firedTimerCount;
+}
+
+void TimerAPI::Schedule(int timerid, Timer *timer)
+{
+    timer->generation = ++nextGeneration;
+    deadlines.push({timer->startTime + timer->targetMsec, timerid, timer->generation});
+}
+
+bool TimerAPI::IsScheduled(const ScheduledTimer &scheduledTimer)
+{
+    auto it = timers.find(scheduledTimer.timerId);
+
+    if (it == timers.end() || it->second == nullptr)
+        return false;
+
+    return !it->second->IsEnded() && it->second->generation == scheduledTimer.generation;
+}
+
+void TimerAPI::DiscardStaleTimers()
+{
+    std::vector<ScheduledTimer> liveTimers;
+    liveTimers.reserve(activeTimerCount);
+
+    while (!deadlines.empty())
+    {
+        if (IsScheduled(deadlines.top()))
+            liveTimers.push_back(deadlines.top());
+        deadlines.pop();
+    }
+
+    deadlines = decltype(deadlines)(std::greater<ScheduledTimer>(), std::move(liveTimers));
 }
@@ -1,7 +1,10 @@
 #ifndef OPENMW_TIMERAPI_HPP
 #define OPENMW_TIMERAPI_HPP
 
+#include <functional>
+#include <queue>
 #include <string>
+#include <vector>
 
 #include <Script/Script.hpp>
 #include <Script/ScriptFunction.hpp>
@@ -21,14 +24,15 @@ namespace mwmp
 #if defined(ENABLE_LUA)
         Timer(lua_State *lua, ScriptFuncLua callback, long msec, const std::string& def, std::vector<boost::any> args);
 #endif
-        void Tick();
-
         bool IsEnded();
         void Stop();
         void Start();
         void Restart(int msec);
+
+        static double GetCurrentMsec();
     private:
         double startTime, targetMsec;
+        unsigned long long generation;
         std::string publ, arg_types;
         std::vector<boost::any> args;
         Script *scr;
@@ -51,9 +55,38 @@ namespace mwmp
         static void Terminate();
 
         static void Tick();
+
+        // Get the milliseconds left until the earliest running timer elapses, or -1 if none are running
+        static long GetMsecUntilNextTimer();
+
+        static unsigned int GetActiveTimerCount();
+        static unsigned long long GetFiredTimerCount();
     private:
+        // An entry in the deadline queue, which is only valid for as long as its timer still has
+        // the same generation, i.e. has not been stopped, restarted or freed since
+        struct ScheduledTimer
+        {
+            double deadline;
+            int timerId;
+            unsigned long long generation;
+
+            bool operator>(const ScheduledTimer &other) const
+            {
+                return deadline > other.deadline;
+            }
+        };
+
+        static void Schedule(int timerid, Timer *timer);
+        static bool IsScheduled(const ScheduledTimer &scheduledTimer);
+        static void DiscardStaleTimers();
+
         static std::unordered_map<int, Timer* > timers;
         static int pointer;
+
+        static std::priority_queue<ScheduledTimer, std::vector<ScheduledTimer>, std::greater<ScheduledTimer>> deadlines;
+        static unsigned long long nextGeneration;
+        static unsigned int activeTimerCount;
+        static unsigned long long firedTimerCount;
     };
 }
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <components/openmw-mp/NetworkMessages.hpp>
 #include <components/openmw-mp/Base/BaseActor.hpp>
 
@@ -127,6 +129,30 @@ double ActorFunctions::GetActorHealthModified(unsigned int index) noexcept
     return readActorList->baseActors.at(index).creatureStats.mDynamic[0].mMod;
 }
 
+unsigned int ActorFunctions::GetActors(ScriptActor *actors, unsigned int maxCount) noexcept
+{
+    unsigned int count = std::min<size_t>(std::min(maxCount, readActorList->count), readActorList->baseActors.size());
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const BaseActor &actor = readActorList->baseActors[i];
+
+        actors[i].refId = actor.refId.c_str();
+        actors[i].refNum = actor.refNum;
+        actors[i].mpNum = actor.mpNum;
+        actors[i].posX = actor.position.pos[0];
+        actors[i].posY = actor.position.pos[1];
+        actors[i].posZ = actor.position.pos[2];
+        actors[i].rotX = actor.position.rot[0];
+        actors[i].rotY = actor.position.rot[1];
+        actors[i].rotZ = actor.position.rot[2];
+        actors[i].healthBase = actor.creatureStats.mDynamic[0].mBase;
+        actors[i].healthCurrent = actor.creatureStats.mDynamic[0].mCurrent;
+    }
+
+    return count;
+}
+
 double ActorFunctions::GetActorMagickaBase(unsigned int index) noexcept
 {
     return readActorList->baseActors.at(index).creatureStats.mDynamic[1].mBase;
@@ -13,6 +13,8 @@
     {"GetActorListSize",                       ActorFunctions::GetActorListSize},\
     {"GetActorListAction",                     ActorFunctions::GetActorListAction},\
     \
+    {"GetActors",                              ActorFunctions::GetActors},\
+    \
     {"GetActorCell",                           ActorFunctions::GetActorCell},\
     {"GetActorRefId",                          ActorFunctions::GetActorRefId},\
     {"GetActorRefNum",                         ActorFunctions::GetActorRefNum},\
@@ -102,6 +104,26 @@
     {"GetActorKillerRefNumIndex",              ActorFunctions::GetActorKillerRefNumIndex},\
     {"SetActorRefNumIndex",                    ActorFunctions::SetActorRefNumIndex}
 
+/**
+* \brief A packed actor used by the bulk actor list accessor.
+*
+* The refId is owned by the read actor list and remains valid until another actor list is read.
+*/
+struct ScriptActor
+{
+    const char *refId;
+    unsigned int refNum;
+    unsigned int mpNum;
+    double posX;
+    double posY;
+    double posZ;
+    double rotX;
+    double rotY;
+    double rotZ;
+    double healthBase;
+    double healthCurrent;
+};
+
 class ActorFunctions
 {
 public:
@@ -266,6 +288,18 @@ public:
     */
     static double GetActorHealthModified(unsigned int index) noexcept;
 
+    /**
+    * \brief Copy the identity, position and health of every actor in the read actor list into an array.
+    *
+    * This is equivalent to calling the individual GetActor getters for every index, but crosses the
+    * script boundary only once.
+    *
+    * \param actors The array to fill.
+    * \param maxCount The capacity of the array.
+    * \return The number of actors copied.
+    */
+    static unsigned int GetActors(ScriptActor *actors, unsigned int maxCount) noexcept;
+
     /**
     * \brief Get the base magicka of the actor at a certain index in the read actor list.
     *
@@ -1,5 +1,7 @@
 #include "Items.hpp"
 
+#include <algorithm>
+
 #include <components/misc/stringops.hpp>
 #include <components/openmw-mp/NetworkMessages.hpp>
 
@@ -85,6 +87,26 @@ void ItemFunctions::AddItemChange(unsigned short pid, const char* refId, unsigne
     player->inventoryChanges.items.push_back(item);
 }
 
+void ItemFunctions::AddItemChanges(unsigned short pid, const ScriptInventoryItem *items, unsigned int count) noexcept
+{
+    Player *player;
+    GET_PLAYER(pid, player, );
+
+    player->inventoryChanges.items.reserve(player->inventoryChanges.items.size() + count);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        Item item;
+        item.refId = items[i].refId;
+        item.count = items[i].count;
+        item.charge = items[i].charge;
+        item.enchantmentCharge = items[i].enchantmentCharge;
+        item.soul = items[i].soul;
+
+        player->inventoryChanges.items.push_back(item);
+    }
+}
+
 bool ItemFunctions::HasItemEquipped(unsigned short pid, const char* refId)
 {
     Player *player;
@@ -174,6 +196,27 @@ const char *ItemFunctions::GetInventoryItemSoul(unsigned short pid, unsigned int
     return player->inventoryChanges.items.at(index).soul.c_str();
 }
 
+unsigned int ItemFunctions::GetInventoryItems(unsigned short pid, ScriptInventoryItem *items, unsigned int maxCount) noexcept
+{
+    Player *player;
+    GET_PLAYER(pid, player, 0);
+
+    unsigned int count = std::min<size_t>(maxCount, player->inventoryChanges.items.size());
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const Item &item = player->inventoryChanges.items[i];
+
+        items[i].refId = item.refId.c_str();
+        items[i].count = item.count;
+        items[i].charge = item.charge;
+        items[i].enchantmentCharge = item.enchantmentCharge;
+        items[i].soul = item.soul.c_str();
+    }
+
+    return count;
+}
+
 const char *ItemFunctions::GetUsedItemRefId(unsigned short pid) noexcept
 {
     Player *player;
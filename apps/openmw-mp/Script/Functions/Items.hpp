@@ -14,6 +14,7 @@
     {"UnequipItem",                           ItemFunctions::UnequipItem},\
     \
     {"AddItemChange",                         ItemFunctions::AddItemChange},\
+    {"AddItemChanges",                        ItemFunctions::AddItemChanges},\
     \
     {"HasItemEquipped",                       ItemFunctions::HasItemEquipped},\
     \
@@ -27,6 +28,7 @@
     {"GetInventoryItemCharge",                ItemFunctions::GetInventoryItemCharge},\
     {"GetInventoryItemEnchantmentCharge",     ItemFunctions::GetInventoryItemEnchantmentCharge},\
     {"GetInventoryItemSoul",                  ItemFunctions::GetInventoryItemSoul},\
+    {"GetInventoryItems",                     ItemFunctions::GetInventoryItems},\
     \
     {"GetUsedItemRefId",                      ItemFunctions::GetUsedItemRefId},\
     {"GetUsedItemCount",                      ItemFunctions::GetUsedItemCount},\
@@ -41,6 +43,21 @@
     {"InitializeInventoryChanges",            ItemFunctions::InitializeInventoryChanges},\
     {"AddItem",                               ItemFunctions::AddItem}
 
+/**
+* \brief A packed inventory item used by the bulk inventory accessors.
+*
+* The strings are owned by the player's inventory changes and remain valid until those changes are
+* modified or cleared.
+*/
+struct ScriptInventoryItem
+{
+    const char *refId;
+    int count;
+    int charge;
+    double enchantmentCharge;
+    const char *soul;
+};
+
 class ItemFunctions
 {
 public:
@@ -126,6 +143,16 @@ public:
     static void AddItemChange(unsigned short pid, const char* refId, unsigned int count, int charge,
         double enchantmentCharge, const char* soul) noexcept;
 
+    /**
+    * \brief Add several item changes to a player's inventory changes in a single call.
+    *
+    * \param pid The player ID.
+    * \param items The items to add.
+    * \param count The number of items in the array.
+    * \return void
+    */
+    static void AddItemChanges(unsigned short pid, const ScriptInventoryItem *items, unsigned int count) noexcept;
+
     /**
     * \brief Check whether a player has equipped an item with a certain refId in any slot.
     *
@@ -222,6 +249,19 @@ public:
     */
     static const char *GetInventoryItemSoul(unsigned short pid, unsigned int index) noexcept;
 
+    /**
+    * \brief Copy every item in a player's latest inventory changes into an array.
+    *
+    * This is equivalent to calling the individual GetInventoryItem getters for every index, but
+    * crosses the script boundary only once.
+    *
+    * \param pid The player ID whose inventory changes should be used.
+    * \param items The array to fill.
+    * \param maxCount The capacity of the array.
+    * \return The number of items copied.
+    */
+    static unsigned int GetInventoryItems(unsigned short pid, ScriptInventoryItem *items, unsigned int maxCount) noexcept;
+
     /**
     * \brief Get the refId of the item last used by a player.
     *
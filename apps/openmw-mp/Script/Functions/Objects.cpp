@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <components/openmw-mp/NetworkMessages.hpp>
 #include <components/openmw-mp/Base/BaseObject.hpp>
 
@@ -124,6 +126,28 @@ int ObjectFunctions::GetObjectGoldValue(unsigned int index) noexcept
     return readObjectList->baseObjects.at(index).goldValue;
 }
 
+unsigned int ObjectFunctions::GetObjects(ScriptObject *objects, unsigned int maxCount) noexcept
+{
+    unsigned int count = std::min<size_t>(std::min(maxCount, readObjectList->baseObjectCount),
+        readObjectList->baseObjects.size());
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const BaseObject &object = readObjectList->baseObjects[i];
+
+        objects[i].refId = object.refId.c_str();
+        objects[i].refNum = object.refNum;
+        objects[i].mpNum = object.mpNum;
+        objects[i].count = object.count;
+        objects[i].charge = object.charge;
+        objects[i].enchantmentCharge = object.enchantmentCharge;
+        objects[i].soul = object.soul.c_str();
+        objects[i].goldValue = object.goldValue;
+    }
+
+    return count;
+}
+
 double ObjectFunctions::GetObjectScale(unsigned int index) noexcept
 {
     return readObjectList->baseObjects.at(index).scale;
@@ -15,6 +15,8 @@
     {"GetObjectListAction",                   ObjectFunctions::GetObjectListAction},\
     {"GetObjectListContainerSubAction",       ObjectFunctions::GetObjectListContainerSubAction},\
     \
+    {"GetObjects",                            ObjectFunctions::GetObjects},\
+    \
     {"IsObjectPlayer",                        ObjectFunctions::IsObjectPlayer},\
     {"GetObjectPid",                          ObjectFunctions::GetObjectPid},\
     {"GetObjectRefId",                        ObjectFunctions::GetObjectRefId},\
@@ -143,6 +145,23 @@
     {"SetObjectRefNumIndex",                  ObjectFunctions::SetObjectRefNumIndex},\
     {"AddWorldObject",                        ObjectFunctions::AddWorldObject}
 
+/**
+* \brief A packed object used by the bulk object list accessor.
+*
+* The strings are owned by the read object list and remain valid until another object list is read.
+*/
+struct ScriptObject
+{
+    const char *refId;
+    unsigned int refNum;
+    unsigned int mpNum;
+    int count;
+    int charge;
+    double enchantmentCharge;
+    const char *soul;
+    int goldValue;
+};
+
 class ObjectFunctions
 {
 public:
@@ -308,6 +327,19 @@ public:
     */
     static int GetObjectGoldValue(unsigned int index) noexcept;
 
+    /**
+    * \brief Copy the main fields of every object in the read object list into an array.
+    *
+    * This is equivalent to calling GetObjectRefId, GetObjectRefNum, GetObjectMpNum, GetObjectCount,
+    * GetObjectCharge, GetObjectEnchantmentCharge, GetObjectSoul and GetObjectGoldValue for every
+    * index, but crosses the script boundary only once.
+    *
+    * \param objects The array to fill.
+    * \param maxCount The capacity of the array.
+    * \return The number of objects copied.
+    */
+    static unsigned int GetObjects(ScriptObject *objects, unsigned int maxCount) noexcept;
+
     /**
     * \brief Get the object scale of the object at a certain index in the read object list.
     *
@@ -8,9 +8,11 @@
 #include <apps/openmw-mp/Script/ScriptFunctions.hpp>
 #include <apps/openmw-mp/Networking.hpp>
 #include <apps/openmw-mp/MasterClient.hpp>
+#include <apps/openmw-mp/PacketProfiler.hpp>
 #include <Script/Script.hpp>
 
 static std::string tempFilename;
+static std::string tempPacketProfile;
 static std::chrono::high_resolution_clock::time_point startupTime = std::chrono::high_resolution_clock::now();
 
 void ServerFunctions::LogMessage(unsigned short level, const char *message) noexcept
@@ -145,6 +147,27 @@ bool ServerFunctions::GetScriptErrorIgnoringState() noexcept
     return mwmp::Networking::getPtr()->getScriptErrorIgnoringState();
 }
 
+double ServerFunctions::GetPacketBytesEncoded() noexcept
+{
+    return static_cast<double>(mwmp::BasePacket::getBytesEncoded());
+}
+
+double ServerFunctions::GetPacketBytesSent() noexcept
+{
+    return static_cast<double>(mwmp::BasePacket::getBytesSent());
+}
+
+const char *ServerFunctions::GetPacketProfile() noexcept
+{
+    tempPacketProfile = PacketProfiler::getJson();
+    return tempPacketProfile.c_str();
+}
+
+void ServerFunctions::ResetPacketProfile() noexcept
+{
+    PacketProfiler::reset();
+}
+
 void ServerFunctions::SetGameMode(const char *gameMode) noexcept
 {
     if (mwmp::Networking::getPtr()->getMasterClient())
@@ -172,6 +195,11 @@ void ServerFunctions::SetScriptErrorIgnoringState(bool state) noexcept
     mwmp::Networking::getPtr()->setScriptErrorIgnoringState(state);
 }
 
+void ServerFunctions::SetPacketProfilingState(bool state) noexcept
+{
+    PacketProfiler::setEnabled(state);
+}
+
 void ServerFunctions::SetRuleString(const char *key, const char *value) noexcept
 {
     auto mc = mwmp::Networking::getPtr()->getMasterClient();
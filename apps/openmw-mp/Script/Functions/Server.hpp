@@ -28,12 +28,17 @@
     {"HasPassword",                     ServerFunctions::HasPassword},\
     {"GetDataFileEnforcementState",     ServerFunctions::GetDataFileEnforcementState},\
     {"GetScriptErrorIgnoringState",     ServerFunctions::GetScriptErrorIgnoringState},\
+    {"GetPacketBytesEncoded",           ServerFunctions::GetPacketBytesEncoded},\
+    {"GetPacketBytesSent",              ServerFunctions::GetPacketBytesSent},\
+    {"GetPacketProfile",                ServerFunctions::GetPacketProfile},\
+    {"ResetPacketProfile",              ServerFunctions::ResetPacketProfile},\
     \
     {"SetGameMode",                     ServerFunctions::SetGameMode},\
     {"SetHostname",                     ServerFunctions::SetHostname},\
     {"SetServerPassword",               ServerFunctions::SetServerPassword},\
     {"SetDataFileEnforcementState",     ServerFunctions::SetDataFileEnforcementState},\
     {"SetScriptErrorIgnoringState",     ServerFunctions::SetScriptErrorIgnoringState},\
+    {"SetPacketProfilingState",         ServerFunctions::SetPacketProfilingState},\
     {"SetRuleString",                   ServerFunctions::SetRuleString},\
     {"SetRuleValue",                    ServerFunctions::SetRuleValue},\
     \
@@ -227,6 +232,41 @@ public:
     */
     static bool GetScriptErrorIgnoringState() noexcept;
 
+    /**
+    * \brief Get the total number of bytes the server has encoded into outgoing packets.
+    *
+    * Packets sent to several players at once are only encoded once, so comparing this
+    * with GetPacketBytesSent() shows how much serialization work has been saved.
+    *
+    * \return The number of bytes encoded since the server's startup.
+    */
+    static double GetPacketBytesEncoded() noexcept;
+
+    /**
+    * \brief Get the total number of bytes the server has handed to the network for sending.
+    *
+    * \return The number of bytes sent since the server's startup.
+    */
+    static double GetPacketBytesSent() noexcept;
+
+    /**
+    * \brief Get the statistics gathered about every packet type as a JSON object.
+    *
+    * For every packet ID, this lists how many packets were received and sent, their total size,
+    * and the time spent decoding them, processing them and running script callbacks for them.
+    * Packets are only measured while packet profiling is enabled.
+    *
+    * \return The JSON object.
+    */
+    static const char *GetPacketProfile() noexcept;
+
+    /**
+    * \brief Clear the statistics gathered about every packet type.
+    *
+    * \return void
+    */
+    static void ResetPacketProfile() noexcept;
+
     /**
     * \brief Set the game mode of the server, as displayed in the server browser.
     *
@@ -273,6 +313,14 @@ public:
     */
     static void SetScriptErrorIgnoringState(bool state) noexcept;
 
+    /**
+    * \brief Set whether the traffic and handling time of every packet type should be measured.
+    *
+    * \param state The new packet profiling state.
+    * \return void
+    */
+    static void SetPacketProfilingState(bool state) noexcept;
+
     /**
     * \brief Set a rule string for the server details displayed in the server browser.
     *
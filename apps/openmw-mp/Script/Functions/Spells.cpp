@@ -1,5 +1,7 @@
 #include "Spells.hpp"
 
+#include <algorithm>
+
 #include <components/misc/stringops.hpp>
 #include <components/openmw-mp/NetworkMessages.hpp>
 
@@ -51,6 +53,22 @@ void SpellFunctions::AddSpell(unsigned short pid, const char* spellId) noexcept
     player->spellbookChanges.spells.push_back(spell);
 }
 
+void SpellFunctions::AddSpells(unsigned short pid, const char **spellIds, unsigned int count) noexcept
+{
+    Player *player;
+    GET_PLAYER(pid, player, );
+
+    player->spellbookChanges.spells.reserve(player->spellbookChanges.spells.size() + count);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        ESM::Spell spell;
+        spell.mId = spellIds[i];
+
+        player->spellbookChanges.spells.push_back(spell);
+    }
+}
+
 const char *SpellFunctions::GetSpellId(unsigned short pid, unsigned int index) noexcept
 {
     Player *player;
@@ -62,6 +80,19 @@ const char *SpellFunctions::GetSpellId(unsigned short pid, unsigned int index) n
     return player->spellbookChanges.spells.at(index).mId.c_str();
 }
 
+unsigned int SpellFunctions::GetSpellIds(unsigned short pid, const char **spellIds, unsigned int maxCount) noexcept
+{
+    Player *player;
+    GET_PLAYER(pid, player, 0);
+
+    unsigned int count = std::min<size_t>(maxCount, player->spellbookChanges.spells.size());
+
+    for (unsigned int i = 0; i < count; i++)
+        spellIds[i] = player->spellbookChanges.spells[i].mId.c_str();
+
+    return count;
+}
+
 void SpellFunctions::SendSpellbookChanges(unsigned short pid, bool sendToOtherPlayers, bool skipAttachedPlayer) noexcept
 {
     Player *player;
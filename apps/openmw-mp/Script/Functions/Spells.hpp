@@ -9,8 +9,10 @@
     \
     {"SetSpellbookChangesAction",  SpellFunctions::SetSpellbookChangesAction},\
     {"AddSpell",                   SpellFunctions::AddSpell},\
+    {"AddSpells",                  SpellFunctions::AddSpells},\
     \
     {"GetSpellId",                 SpellFunctions::GetSpellId},\
+    {"GetSpellIds",                SpellFunctions::GetSpellIds},\
     \
     {"SendSpellbookChanges",       SpellFunctions::SendSpellbookChanges},\
     \
@@ -64,6 +66,16 @@ public:
     */
     static void AddSpell(unsigned short pid, const char* spellId) noexcept;
 
+    /**
+    * \brief Add several spells to the spellbook changes for a player in a single call.
+    *
+    * \param pid The player ID whose spellbook changes should be used.
+    * \param spellIds The spellIds of the spells.
+    * \param count The number of spellIds in the array.
+    * \return void
+    */
+    static void AddSpells(unsigned short pid, const char **spellIds, unsigned int count) noexcept;
+
     /**
     * \brief Get the spellId at a certain index in a player's latest spellbook changes.
     *
@@ -73,6 +85,18 @@ public:
     */
     static const char *GetSpellId(unsigned short pid, unsigned int index) noexcept;
 
+    /**
+    * \brief Copy the spellIds of every spell in a player's latest spellbook changes into an array.
+    *
+    * The strings remain valid until the player's spellbook changes are modified or cleared.
+    *
+    * \param pid The player ID whose spellbook changes should be used.
+    * \param spellIds The array to fill.
+    * \param maxCount The capacity of the array.
+    * \return The number of spellIds copied.
+    */
+    static unsigned int GetSpellIds(unsigned short pid, const char **spellIds, unsigned int maxCount) noexcept;
+
     /**
     * \brief Send a PlayerSpellbook packet with a player's recorded spellbook changes.
     *
@@ -0,0 +1,56 @@
+#include "Storage.hpp"
+
+#include <apps/openmw-mp/WorldStore.hpp>
+
+using namespace std;
+
+static vector<string> loadedKeys;
+
+bool StorageFunctions::IsStoreOpen() noexcept
+{
+    return WorldStore::isOpen();
+}
+
+bool StorageFunctions::HasStoredValue(const char *category, const char *key) noexcept
+{
+    return WorldStore::has(category, key);
+}
+
+const char *StorageFunctions::GetStoredValue(const char *category, const char *key) noexcept
+{
+    const string *value = WorldStore::get(category, key);
+
+    if (value == nullptr)
+        return "";
+
+    return value->c_str();
+}
+
+void StorageFunctions::SetStoredValue(const char *category, const char *key, const char *value) noexcept
+{
+    WorldStore::set(category, key, value);
+}
+
+void StorageFunctions::RemoveStoredValue(const char *category, const char *key) noexcept
+{
+    WorldStore::remove(category, key);
+}
+
+unsigned int StorageFunctions::LoadStoredKeys(const char *category) noexcept
+{
+    loadedKeys = WorldStore::getKeys(category);
+    return loadedKeys.size();
+}
+
+const char *StorageFunctions::GetStoredKey(unsigned int index) noexcept
+{
+    if (index >= loadedKeys.size())
+        return "invalid";
+
+    return loadedKeys.at(index).c_str();
+}
+
+void StorageFunctions::FlushStore() noexcept
+{
+    WorldStore::flush();
+}
@@ -0,0 +1,103 @@
+#ifndef OPENMW_STORAGEAPI_HPP
+#define OPENMW_STORAGEAPI_HPP
+
+#include "../Types.hpp"
+
+#define STORAGEAPI \
+    {"IsStoreOpen",                 StorageFunctions::IsStoreOpen},\
+    \
+    {"HasStoredValue",              StorageFunctions::HasStoredValue},\
+    {"GetStoredValue",              StorageFunctions::GetStoredValue},\
+    {"SetStoredValue",              StorageFunctions::SetStoredValue},\
+    {"RemoveStoredValue",           StorageFunctions::RemoveStoredValue},\
+    \
+    {"LoadStoredKeys",              StorageFunctions::LoadStoredKeys},\
+    {"GetStoredKey",                StorageFunctions::GetStoredKey},\
+    \
+    {"FlushStore",                  StorageFunctions::FlushStore}
+
+class StorageFunctions
+{
+public:
+
+    /**
+    * \brief Check whether the server's world store was opened successfully.
+    *
+    * The world store keeps string values by category and key, such as "player" and a player's
+    * name, "cell" and a cell description, or "record" and a record's refId. Changes to it are
+    * written to an append-only log file on a separate thread, so storing a value never makes the
+    * server wait for the disk.
+    *
+    * \return Whether the world store is open.
+    */
+    static bool IsStoreOpen() noexcept;
+
+    /**
+    * \brief Check whether a value is stored for a key in a category.
+    *
+    * \param category The category.
+    * \param key The key.
+    * \return Whether the value exists.
+    */
+    static bool HasStoredValue(const char *category, const char *key) noexcept;
+
+    /**
+    * \brief Get the value stored for a key in a category.
+    *
+    * \param category The category.
+    * \param key The key.
+    * \return The value, or an empty string if there is none.
+    */
+    static const char *GetStoredValue(const char *category, const char *key) noexcept;
+
+    /**
+    * \brief Store a value for a key in a category, replacing any previous one.
+    *
+    * Only the change itself is written to the world store's log, regardless of how many other
+    * keys the category has.
+    *
+    * \param category The category.
+    * \param key The key.
+    * \param value The value.
+    * \return void
+    */
+    static void SetStoredValue(const char *category, const char *key, const char *value) noexcept;
+
+    /**
+    * \brief Remove the value stored for a key in a category.
+    *
+    * \param category The category.
+    * \param key The key.
+    * \return void
+    */
+    static void RemoveStoredValue(const char *category, const char *key) noexcept;
+
+    /**
+    * \brief Load the keys of a category in alphabetical order, so they can be read
+    *        with GetStoredKey().
+    *
+    * \param category The category.
+    * \return The number of keys.
+    */
+    static unsigned int LoadStoredKeys(const char *category) noexcept;
+
+    /**
+    * \brief Get a key at a certain index among those loaded by the last call of LoadStoredKeys().
+    *
+    * \param index The index of the key.
+    * \return The key.
+    */
+    static const char *GetStoredKey(unsigned int index) noexcept;
+
+    /**
+    * \brief Have the world store write its changes so far to its log right away instead
+    *        of at its next flush interval.
+    *
+    * The writing still happens on a separate thread, so this does not wait for it to finish.
+    *
+    * \return void
+    */
+    static void FlushStore() noexcept;
+};
+
+#endif //OPENMW_STORAGEAPI_HPP
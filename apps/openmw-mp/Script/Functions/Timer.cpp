@@ -52,3 +52,13 @@ bool ScriptFunctions::IsTimerElapsed(int timerId) noexcept
 {
     return TimerAPI::IsTimerElapsed(timerId);
 }
+
+unsigned int ScriptFunctions::GetActiveTimerCount() noexcept
+{
+    return TimerAPI::GetActiveTimerCount();
+}
+
+double ScriptFunctions::GetFiredTimerCount() noexcept
+{
+    return static_cast<double>(TimerAPI::GetFiredTimerCount());
+}
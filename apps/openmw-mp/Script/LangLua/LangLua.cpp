@@ -184,6 +184,14 @@ void LangLua::LoadProgram(const char *filename)
     for (unsigned i = 0; i < functions_n; i++)
         tes3mp.addCFunction(functions_[i].name, functions_[i].func);
 
+    // Bulk accessors take packed arrays natively, so Lua gets versions that exchange tables instead
+    tes3mp.addCFunction("GetInventoryItems", LangLua::GetInventoryItems);
+    tes3mp.addCFunction("AddItemChanges", LangLua::AddItemChanges);
+    tes3mp.addCFunction("GetSpellIds", LangLua::GetSpellIds);
+    tes3mp.addCFunction("AddSpells", LangLua::AddSpells);
+    tes3mp.addCFunction("GetObjects", LangLua::GetObjects);
+    tes3mp.addCFunction("GetActors", LangLua::GetActors);
+
     tes3mp.endNamespace();
 
     if ((err = lua_pcall(lua, 0, 0, 0)) != 0) // Run once script for load in memory.
@@ -202,49 +210,44 @@ bool LangLua::IsCallbackPresent(const char *name)
     return luabridge::getGlobal(lua, name).isFunction();
 }
 
-boost::any LangLua::Call(const char *name, const char *argl, int buf, ...)
+static int pushArguments(lua_State *lua, const char *argl, va_list *vargs)
 {
-    va_list vargs;
-    va_start(vargs, buf);
-
     int n_args = (int)(strlen(argl));
 
-    lua_getglobal(lua, name);
-
     for (int index = 0; index < n_args; index++)
     {
         switch (argl[index])
         {
             case 'i':
-                luabridge::Stack<unsigned int>::push(lua,va_arg(vargs, unsigned int));
+                luabridge::Stack<unsigned int>::push(lua, va_arg(*vargs, unsigned int));
                 break;
 
             case 'q':
-                luabridge::Stack<signed int>::push(lua,va_arg(vargs, signed int));
+                luabridge::Stack<signed int>::push(lua, va_arg(*vargs, signed int));
                 break;
 
             case 'l':
-                luabridge::Stack<unsigned long long>::push(lua, va_arg(vargs, unsigned long long));
+                luabridge::Stack<unsigned long long>::push(lua, va_arg(*vargs, unsigned long long));
                 break;
 
             case 'w':
-                luabridge::Stack<signed long long>::push(lua, va_arg(vargs, signed long long));
+                luabridge::Stack<signed long long>::push(lua, va_arg(*vargs, signed long long));
                 break;
 
             case 'f':
-                luabridge::Stack<double>::push(lua, va_arg(vargs, double));
+                luabridge::Stack<double>::push(lua, va_arg(*vargs, double));
                 break;
 
             case 'p':
-                luabridge::Stack<void*>::push(lua, va_arg(vargs, void*));
+                luabridge::Stack<void*>::push(lua, va_arg(*vargs, void*));
                 break;
 
             case 's':
-                luabridge::Stack<const char*>::push(lua, va_arg(vargs, const char*));
+                luabridge::Stack<const char*>::push(lua, va_arg(*vargs, const char*));
                 break;
 
             case 'b':
-                luabridge::Stack<bool>::push(lua, (bool) va_arg(vargs, int));
+                luabridge::Stack<bool>::push(lua, (bool) va_arg(*vargs, int));
                 break;
 
             default:
@@ -252,12 +255,55 @@ boost::any LangLua::Call(const char *name, const char *argl, int buf, ...)
         }
     }
 
+    return n_args;
+}
+
+boost::any LangLua::Call(const char *name, const char *argl, int buf, ...)
+{
+    va_list vargs;
+    va_start(vargs, buf);
+
+    lua_getglobal(lua, name);
+    int n_args = pushArguments(lua, argl, &vargs);
+
     va_end(vargs);
 
     luabridge::LuaException::pcall(lua, n_args, 1);
     return boost::any(luabridge::LuaRef::fromStack(lua, -1));
 }
 
+int LangLua::ResolveCallback(const char *name)
+{
+    lua_getglobal(lua, name);
+
+    if (!lua_isfunction(lua, -1))
+    {
+        lua_pop(lua, 1);
+        return -1;
+    }
+
+    return luaL_ref(lua, LUA_REGISTRYINDEX);
+}
+
+void LangLua::ReleaseCallback(int handle)
+{
+    luaL_unref(lua, LUA_REGISTRYINDEX, handle);
+}
+
+void LangLua::CallResolved(int handle, const char *argl, ...)
+{
+    va_list vargs;
+    va_start(vargs, argl);
+
+    lua_rawgeti(lua, LUA_REGISTRYINDEX, handle);
+    int n_args = pushArguments(lua, argl, &vargs);
+
+    va_end(vargs);
+
+    // Callback results are never used, so don't leave them on the stack
+    luabridge::LuaException::pcall(lua, n_args, 0);
+}
+
 boost::any LangLua::Call(const char *name, const char *argl, const std::vector<boost::any> &args)
 {
     int n_args = (int)(strlen(argl));
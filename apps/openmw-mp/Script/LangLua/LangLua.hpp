@@ -36,11 +36,21 @@ public:
     static int CreateTimer(lua_State *lua) noexcept;
     static int CreateTimerEx(lua_State *lua);
 
+    static int GetInventoryItems(lua_State *lua) noexcept;
+    static int AddItemChanges(lua_State *lua) noexcept;
+    static int GetSpellIds(lua_State *lua) noexcept;
+    static int AddSpells(lua_State *lua) noexcept;
+    static int GetObjects(lua_State *lua) noexcept;
+    static int GetActors(lua_State *lua) noexcept;
+
     virtual void LoadProgram(const char *filename) override;
     virtual int FreeProgram() override;
     virtual bool IsCallbackPresent(const char *name) override;
     virtual boost::any Call(const char *name, const char *argl, int buf, ...) override;
     virtual boost::any Call(const char *name, const char *argl, const std::vector<boost::any> &args) override;
+    virtual int ResolveCallback(const char *name) override;
+    virtual void ReleaseCallback(int handle) override;
+    virtual void CallResolved(int handle, const char *argl, ...) override;
 private:
     static std::set<std::string> packageCPath;
     static std::set<std::string> packagePath;
@@ -2,6 +2,10 @@
 #include "LangLua.hpp"
 #include <Script/API/TimerAPI.hpp>
 #include <Script/API/PublicFnAPI.hpp>
+#include <Script/Functions/Actors.hpp>
+#include <Script/Functions/Items.hpp>
+#include <Script/Functions/Objects.hpp>
+#include <Script/Functions/Spells.hpp>
 
 using namespace std;
 
@@ -176,3 +180,189 @@ int LangLua::CreateTimerEx(lua_State *lua)
     luabridge::push(lua, id);
     return 1;
 }
+
+inline void SetField(lua_State *lua, const char *key, double value)
+{
+    lua_pushnumber(lua, value);
+    lua_setfield(lua, -2, key);
+}
+
+inline void SetField(lua_State *lua, const char *key, const char *value)
+{
+    lua_pushstring(lua, value);
+    lua_setfield(lua, -2, key);
+}
+
+inline double GetNumberField(lua_State *lua, int index, const char *key, double defaultValue)
+{
+    lua_getfield(lua, index, key);
+    double value = lua_isnumber(lua, -1) ? lua_tonumber(lua, -1) : defaultValue;
+    lua_pop(lua, 1);
+    return value;
+}
+
+// The returned string is kept alive by the table it was read from, so only actual strings are accepted;
+// lua_tostring would convert a number into a new string that nothing references once it is popped
+inline const char *GetStringField(lua_State *lua, int index, const char *key)
+{
+    lua_getfield(lua, index, key);
+    const char *value = lua_type(lua, -1) == LUA_TSTRING ? lua_tostring(lua, -1) : "";
+    lua_pop(lua, 1);
+    return value;
+}
+
+int LangLua::GetInventoryItems(lua_State *lua) noexcept
+{
+    unsigned short pid = luabridge::Stack<unsigned short>::get(lua, 1);
+
+    vector<ScriptInventoryItem> items(ItemFunctions::GetInventoryChangesSize(pid));
+    unsigned int count = ItemFunctions::GetInventoryItems(pid, items.data(), items.size());
+
+    lua_createtable(lua, count, 0);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        lua_createtable(lua, 0, 5);
+        SetField(lua, "refId", items[i].refId);
+        SetField(lua, "count", items[i].count);
+        SetField(lua, "charge", items[i].charge);
+        SetField(lua, "enchantmentCharge", items[i].enchantmentCharge);
+        SetField(lua, "soul", items[i].soul);
+        lua_rawseti(lua, -2, i + 1);
+    }
+
+    return 1;
+}
+
+int LangLua::AddItemChanges(lua_State *lua) noexcept
+{
+    unsigned short pid = luabridge::Stack<unsigned short>::get(lua, 1);
+
+    if (!lua_istable(lua, 2))
+        return 0;
+
+    vector<ScriptInventoryItem> items;
+
+    for (int i = 1;; i++)
+    {
+        lua_rawgeti(lua, 2, i);
+
+        if (!lua_istable(lua, -1))
+        {
+            lua_pop(lua, 1);
+            break;
+        }
+
+        int itemIndex = lua_gettop(lua);
+
+        ScriptInventoryItem item;
+        item.refId = GetStringField(lua, itemIndex, "refId");
+        item.count = (int) GetNumberField(lua, itemIndex, "count", 1);
+        item.charge = (int) GetNumberField(lua, itemIndex, "charge", -1);
+        item.enchantmentCharge = GetNumberField(lua, itemIndex, "enchantmentCharge", -1);
+        item.soul = GetStringField(lua, itemIndex, "soul");
+        items.push_back(item);
+
+        lua_pop(lua, 1);
+    }
+
+    ItemFunctions::AddItemChanges(pid, items.data(), items.size());
+    return 0;
+}
+
+int LangLua::GetSpellIds(lua_State *lua) noexcept
+{
+    unsigned short pid = luabridge::Stack<unsigned short>::get(lua, 1);
+
+    vector<const char *> spellIds(SpellFunctions::GetSpellbookChangesSize(pid));
+    unsigned int count = SpellFunctions::GetSpellIds(pid, spellIds.data(), spellIds.size());
+
+    lua_createtable(lua, count, 0);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        lua_pushstring(lua, spellIds[i]);
+        lua_rawseti(lua, -2, i + 1);
+    }
+
+    return 1;
+}
+
+int LangLua::AddSpells(lua_State *lua) noexcept
+{
+    unsigned short pid = luabridge::Stack<unsigned short>::get(lua, 1);
+
+    if (!lua_istable(lua, 2))
+        return 0;
+
+    vector<const char *> spellIds;
+
+    for (int i = 1;; i++)
+    {
+        lua_rawgeti(lua, 2, i);
+
+        // As in GetStringField, numbers are not accepted because their converted strings wouldn't outlive the pop
+        if (lua_type(lua, -1) != LUA_TSTRING)
+        {
+            lua_pop(lua, 1);
+            break;
+        }
+
+        spellIds.push_back(lua_tostring(lua, -1));
+        lua_pop(lua, 1);
+    }
+
+    SpellFunctions::AddSpells(pid, spellIds.data(), spellIds.size());
+    return 0;
+}
+
+int LangLua::GetObjects(lua_State *lua) noexcept
+{
+    vector<ScriptObject> objects(ObjectFunctions::GetObjectListSize());
+    unsigned int count = ObjectFunctions::GetObjects(objects.data(), objects.size());
+
+    lua_createtable(lua, count, 0);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        lua_createtable(lua, 0, 8);
+        SetField(lua, "refId", objects[i].refId);
+        SetField(lua, "refNum", objects[i].refNum);
+        SetField(lua, "mpNum", objects[i].mpNum);
+        SetField(lua, "count", objects[i].count);
+        SetField(lua, "charge", objects[i].charge);
+        SetField(lua, "enchantmentCharge", objects[i].enchantmentCharge);
+        SetField(lua, "soul", objects[i].soul);
+        SetField(lua, "goldValue", objects[i].goldValue);
+        lua_rawseti(lua, -2, i + 1);
+    }
+
+    return 1;
+}
+
+int LangLua::GetActors(lua_State *lua) noexcept
+{
+    vector<ScriptActor> actors(ActorFunctions::GetActorListSize());
+    unsigned int count = ActorFunctions::GetActors(actors.data(), actors.size());
+
+    lua_createtable(lua, count, 0);
+
+    for (unsigned int i = 0; i < count; i++)
+    {
+        lua_createtable(lua, 0, 11);
+        SetField(lua, "refId", actors[i].refId);
+        SetField(lua, "refNum", actors[i].refNum);
+        SetField(lua, "mpNum", actors[i].mpNum);
+        SetField(lua, "posX", actors[i].posX);
+        SetField(lua, "posY", actors[i].posY);
+        SetField(lua, "posZ", actors[i].posZ);
+        SetField(lua, "rotX", actors[i].rotX);
+        SetField(lua, "rotY", actors[i].rotY);
+        SetField(lua, "rotZ", actors[i].rotZ);
+        SetField(lua, "healthBase", actors[i].healthBase);
+        SetField(lua, "healthCurrent", actors[i].healthCurrent);
+        lua_rawseti(lua, -2, i + 1);
+    }
+
+    return 1;
+}
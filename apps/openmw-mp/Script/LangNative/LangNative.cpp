@@ -80,6 +80,20 @@ boost::any LangNative::Call(const char *name, const char *argl, const std::vecto
     return nullptr;
 }
 
+int LangNative::ResolveCallback(const char *name)
+{
+    return -1;
+}
+
+void LangNative::ReleaseCallback(int handle)
+{
+
+}
+
+void LangNative::CallResolved(int handle, const char *argl, ...)
+{
+
+}
 
 lib_t LangNative::GetInterface()
 {
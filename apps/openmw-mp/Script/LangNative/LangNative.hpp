@@ -17,6 +17,9 @@ public:
     virtual bool IsCallbackPresent(const char *name) override;
     virtual boost::any Call(const char *name, const char *argl, int buf, ...) override;
     virtual boost::any Call(const char *name, const char *argl, const std::vector<boost::any> &args) override;
+    virtual int ResolveCallback(const char *name) override;
+    virtual void ReleaseCallback(int handle) override;
+    virtual void CallResolved(int handle, const char *argl, ...) override;
 
 };
 
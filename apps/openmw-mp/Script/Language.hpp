@@ -16,6 +16,11 @@ public:
     virtual boost::any Call(const char* name, const char* argl, int buf, ...) = 0;
     virtual boost::any Call(const char* name, const char* argl, const std::vector<boost::any>& args) = 0;
 
+    // Look up a callback once, returning a handle for CallResolved() or -1 if it is not defined
+    virtual int ResolveCallback(const char* name) = 0;
+    virtual void ReleaseCallback(int handle) = 0;
+    virtual void CallResolved(int handle, const char* argl, ...) = 0;
+
     virtual lib_t GetInterface() = 0;
 
 };
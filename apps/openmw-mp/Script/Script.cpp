@@ -48,6 +48,7 @@ Script::Script(const char *path)
         throw;
     }
 
+    resolvedCallbacks.resize(callbackCount);
 }
 
 
@@ -58,6 +59,76 @@ Script::~Script()
     delete lang;
 }
 
+Script::ResolvedCallback &Script::ResolveCallback(unsigned int position)
+{
+    ResolvedCallback &callback = resolvedCallbacks[position];
+
+    if (!callback.isResolved)
+    {
+        const char *name = callbacks[position].name;
+
+        if (script_type == SCRIPT_CPP)
+            callback.function = GetScript<FunctionEllipsis<void>>(name);
+        else
+            callback.handle = lang->ResolveCallback(name);
+
+        callback.isResolved = true;
+    }
+
+    return callback;
+}
+
+void Script::InvalidateCallbacks()
+{
+    for (auto &callback : resolvedCallbacks)
+    {
+        if (callback.handle >= 0)
+            lang->ReleaseCallback(callback.handle);
+
+        callback.isResolved = false;
+        callback.function = nullptr;
+        callback.handle = -1;
+    }
+}
+
+void Script::ResetCallbackCache()
+{
+    for (auto &script : scripts)
+        script->InvalidateCallbacks();
+}
+
+uint64_t Script::GetCallbackCallCount(const char *name)
+{
+    uint64_t callCount = 0;
+
+    for (unsigned int position = 0; position < callbackCount; position++)
+    {
+        if (strcmp(callbacks[position].name, name) != 0)
+            continue;
+
+        for (auto &script : scripts)
+            callCount += script->resolvedCallbacks[position].callCount;
+    }
+
+    return callCount;
+}
+
+double Script::GetCallbackTime(const char *name)
+{
+    double totalMsec = 0;
+
+    for (unsigned int position = 0; position < callbackCount; position++)
+    {
+        if (strcmp(callbacks[position].name, name) != 0)
+            continue;
+
+        for (auto &script : scripts)
+            totalMsec += script->resolvedCallbacks[position].totalMsec;
+    }
+
+    return totalMsec;
+}
+
 void Script::LoadScripts(char *scripts, const char *base)
 {
     char *token = strtok(scripts, ",");
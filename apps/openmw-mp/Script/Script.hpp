@@ -2,8 +2,9 @@
 #define PLUGINSYSTEM3_SCRIPT_HPP
 
 #include <boost/any.hpp>
-#include <unordered_map>
+#include <chrono>
 #include <memory>
+#include <vector>
 
 #include "Types.hpp"
 #include "SystemInterface.hpp"
@@ -12,6 +13,7 @@
 #include "Language.hpp"
 
 #include "Networking.hpp"
+#include "PacketProfiler.hpp"
 
 class Script : private ScriptFunctions
 {
@@ -40,7 +42,26 @@ private:
     }
 
     int script_type;
-    std::unordered_map<unsigned int, FunctionEllipsis<void>> callbacks_;
+
+    // A callback looked up in this script once, along with how often it has been called
+    // and for how long in total
+    struct ResolvedCallback
+    {
+        bool isResolved = false;
+        FunctionEllipsis<void> function = nullptr;
+        int handle = -1;
+
+        uint64_t callCount = 0;
+        double totalMsec = 0;
+    };
+
+    static constexpr unsigned int callbackCount = sizeof(callbacks) / sizeof(callbacks[0]);
+
+    // Indexed by each callback's position in ScriptFunctions::callbacks
+    std::vector<ResolvedCallback> resolvedCallbacks;
+
+    ResolvedCallback &ResolveCallback(unsigned int position);
+    void InvalidateCallbacks();
 
     typedef std::vector<std::unique_ptr<Script>> ScriptList;
     static ScriptList scripts;
@@ -58,6 +79,7 @@ public:
     static void LoadScript(const char *script, const char* base);
     static void LoadScripts(char* scripts, const char* base);
     static void UnloadScripts();
+    static void ResetCallbackCache();
     static void SetModDir(const std::string &moddir);
     static const char* GetModDir();
 
@@ -65,6 +87,13 @@ public:
         return callbacks[N].index == I ? callbacks[N] : CallBackData(I, N + 1);
     }
 
+    static constexpr unsigned int CallbackPosition(const unsigned int I, const unsigned int N = 0) {
+        return callbacks[N].index == I ? N : CallbackPosition(I, N + 1);
+    }
+
+    static uint64_t GetCallbackCallCount(const char *name);
+    static double GetCallbackTime(const char *name);
+
     template<size_t N>
     static constexpr unsigned int CallbackIdentity(const char(&str)[N])
     {
@@ -77,26 +106,27 @@ public:
         static_assert(data.callback.matches(TypeString<typename std::remove_reference<Args>::type...>::value),
                       "Wrong number or types of arguments");
 
+        constexpr unsigned int position = CallbackPosition(I);
+
         unsigned int count = 0;
 
         for (auto& script : scripts)
         {
-            if (!script->callbacks_.count(I))
-                script->callbacks_.emplace(I, script->GetScript<FunctionEllipsis<void>>(data.name));
-
-            auto callback = script->callbacks_[I];
+            ResolvedCallback &callback = script->ResolveCallback(position);
 
-            if (!callback)
+            if (!callback.function && callback.handle < 0)
                 continue;
 
+            auto startTime = std::chrono::steady_clock::now();
+
             if (script->script_type == SCRIPT_CPP)
-                (callback)(std::forward<Args>(args)...);
+                (callback.function)(std::forward<Args>(args)...);
 #if defined (ENABLE_LUA)
             else if (script->script_type == SCRIPT_LUA)
             {
                 try
                 {
-                    script->lang->Call(data.name, data.callback.types, B, std::forward<Args>(args)...);
+                    script->lang->CallResolved(callback.handle, data.callback.types, std::forward<Args>(args)...);
                 }
                 catch (std::exception &e)
                 {
@@ -108,6 +138,12 @@ public:
                 }
             }
 #endif
+            auto callTime = std::chrono::steady_clock::now() - startTime;
+
+            callback.callCount++;
+            callback.totalMsec += std::chrono::duration<double, std::milli>(callTime).count();
+            PacketProfiler::recordScript(callTime);
+
             ++count;
         }
 
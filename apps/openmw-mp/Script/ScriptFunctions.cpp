@@ -1,4 +1,5 @@
 #include "ScriptFunctions.hpp"
+#include "Script.hpp"
 #include "API/PublicFnAPI.hpp"
 #include <cstdarg>
 #include <iostream>
@@ -33,3 +34,18 @@ boost::any ScriptFunctions::CallPublic(const char *name, va_list args) noexcept
 
     return 0;
 }
+
+double ScriptFunctions::GetCallbackCallCount(const char *callbackName) noexcept
+{
+    return static_cast<double>(Script::GetCallbackCallCount(callbackName));
+}
+
+double ScriptFunctions::GetCallbackTime(const char *callbackName) noexcept
+{
+    return Script::GetCallbackTime(callbackName);
+}
+
+void ScriptFunctions::ResetCallbackCache() noexcept
+{
+    Script::ResetCallbackCache();
+}
@@ -21,6 +21,7 @@
 #include <Script/Functions/Settings.hpp>
 #include <Script/Functions/Spells.hpp>
 #include <Script/Functions/Stats.hpp>
+#include <Script/Functions/Storage.hpp>
 #include <Script/Functions/Worldstate.hpp>
 #include <RakNetTypes.h>
 #include <tuple>
@@ -116,6 +117,46 @@ public:
     */
     static bool IsTimerElapsed(int timerId) noexcept;
 
+    /**
+    * \brief Get the number of timers that are currently running.
+    *
+    * \return The number of running timers.
+    */
+    static unsigned int GetActiveTimerCount() noexcept;
+
+    /**
+    * \brief Get the number of times timers have elapsed and run their script functions.
+    *
+    * \return The number of elapsed timers since the server's startup.
+    */
+    static double GetFiredTimerCount() noexcept;
+
+    /**
+    * \brief Get the number of times a callback has been run across all scripts.
+    *
+    * \param callbackName The name of the callback, such as OnPlayerCellChange.
+    * \return The number of calls since the server's startup.
+    */
+    static double GetCallbackCallCount(const char *callbackName) noexcept;
+
+    /**
+    * \brief Get the total time spent running a callback across all scripts.
+    *
+    * \param callbackName The name of the callback, such as OnPlayerCellChange.
+    * \return The total time in milliseconds since the server's startup.
+    */
+    static double GetCallbackTime(const char *callbackName) noexcept;
+
+    /**
+    * \brief Make the server look up every script callback again the next time it is run.
+    *
+    * Callbacks are only looked up by name once, so this needs to be used after a script
+    * has replaced any of its callback functions.
+    *
+    * \return void
+    */
+    static void ResetCallbackCache() noexcept;
+
 
     static constexpr ScriptFunctionData functions[]{
             {"CreateTimer",         ScriptFunctions::CreateTimer},
@@ -128,6 +169,12 @@ public:
             {"RestartTimer",        ScriptFunctions::RestartTimer},
             {"FreeTimer",           ScriptFunctions::FreeTimer},
             {"IsTimerElapsed",      ScriptFunctions::IsTimerElapsed},
+            {"GetActiveTimerCount", ScriptFunctions::GetActiveTimerCount},
+            {"GetFiredTimerCount",  ScriptFunctions::GetFiredTimerCount},
+
+            {"GetCallbackCallCount", ScriptFunctions::GetCallbackCallCount},
+            {"GetCallbackTime",      ScriptFunctions::GetCallbackTime},
+            {"ResetCallbackCache",   ScriptFunctions::ResetCallbackCache},
 
             ACTORAPI,
             BOOKAPI,
@@ -148,6 +195,7 @@ public:
             SETTINGSAPI,
             SPELLAPI,
             STATAPI,
+            STORAGEAPI,
             OBJECTAPI,
             WORLDSTATEAPI
     };
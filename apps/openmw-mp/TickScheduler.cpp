@@ -0,0 +1,163 @@
+#include "TickScheduler.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include <components/openmw-mp/TimedLog.hpp>
+
+using namespace mwmp;
+using namespace std;
+
+static const chrono::seconds summaryInterval(60);
+
+// How long to sleep when RakNet has signalled a datagram that has not become a packet yet
+static const chrono::milliseconds pendingPacketWait(1);
+
+TickScheduler::TickScheduler() : isNotified(false), tickRate(0), tickInterval(Clock::duration::zero()),
+    maxIdleWait(chrono::milliseconds(100)), tickCount(0), overrunCount(0), totalTickTime(Clock::duration::zero()),
+    maxTickTime(Clock::duration::zero())
+{
+    tickStart = nextTick = awaitingPacketUntil = Clock::now();
+    nextSummary = tickStart + summaryInterval;
+}
+
+void TickScheduler::setTickRate(unsigned int ticksPerSecond)
+{
+    tickRate = ticksPerSecond;
+
+    if (tickRate == 0)
+        tickInterval = Clock::duration::zero();
+    else
+        tickInterval = chrono::duration_cast<Clock::duration>(chrono::seconds(1)) / tickRate;
+
+    nextTick = Clock::now();
+}
+
+void TickScheduler::setMaxIdleWait(unsigned int msec)
+{
+    maxIdleWait = chrono::milliseconds(msec);
+}
+
+void TickScheduler::notify()
+{
+    {
+        lock_guard<mutex> lock(waitMutex);
+        isNotified = true;
+    }
+    waitCondition.notify_one();
+}
+
+void TickScheduler::onPacketReceived()
+{
+    awaitingPacketUntil = Clock::now();
+}
+
+void TickScheduler::beginTick()
+{
+    tickStart = Clock::now();
+}
+
+void TickScheduler::endTick()
+{
+    Clock::time_point tickEnd = Clock::now();
+    Clock::duration tickTime = tickEnd - tickStart;
+
+    tickCount++;
+    totalTickTime += tickTime;
+    maxTickTime = max(maxTickTime, tickTime);
+
+    if (tickRate != 0)
+    {
+        nextTick += tickInterval;
+
+        if (tickTime > tickInterval)
+            overrunCount++;
+
+        // Don't try to catch up on ticks we have fallen too far behind on
+        if (nextTick < tickEnd)
+            nextTick = tickEnd;
+    }
+
+    if (tickEnd >= nextSummary)
+    {
+        logSummary();
+        nextSummary = tickEnd + summaryInterval;
+    }
+}
+
+void TickScheduler::wait(long msecUntilTimer)
+{
+    // With a fixed tick rate, incoming datagrams simply wait for the next tick
+    if (tickRate != 0)
+    {
+        this_thread::sleep_until(nextTick);
+        return;
+    }
+
+    Clock::time_point now = Clock::now();
+    Clock::time_point timerDeadline = Clock::time_point::max();
+
+    if (msecUntilTimer >= 0)
+        timerDeadline = now + chrono::milliseconds(msecUntilTimer);
+
+    Clock::time_point deadline = min(now + maxIdleWait, timerDeadline);
+
+    // RakNet's own update thread may still be turning a signalled datagram into a packet, so keep
+    // taking quick looks at it until it arrives or we would have woken up anyway
+    if (now < awaitingPacketUntil)
+        deadline = min(deadline, now + pendingPacketWait);
+
+    unique_lock<mutex> lock(waitMutex);
+    waitCondition.wait_until(lock, deadline, [this] { return isNotified; });
+
+    if (isNotified)
+    {
+        isNotified = false;
+
+        now = Clock::now();
+        awaitingPacketUntil = max(awaitingPacketUntil, min(now + maxIdleWait, timerDeadline));
+    }
+}
+
+unsigned int TickScheduler::getTickRate() const
+{
+    return tickRate;
+}
+
+unsigned long long TickScheduler::getTickCount() const
+{
+    return tickCount;
+}
+
+unsigned long long TickScheduler::getOverrunCount() const
+{
+    return overrunCount;
+}
+
+double TickScheduler::getAverageTickMsec() const
+{
+    if (tickCount == 0)
+        return 0;
+
+    return chrono::duration<double, milli>(totalTickTime).count() / tickCount;
+}
+
+double TickScheduler::getMaxTickMsec() const
+{
+    return chrono::duration<double, milli>(maxTickTime).count();
+}
+
+void TickScheduler::logSummary()
+{
+    if (tickRate != 0)
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_VERBOSE, "Ticks: %llu at %u Hz, average %.3f ms, max %.3f ms, %llu over budget",
+            tickCount, tickRate, getAverageTickMsec(), getMaxTickMsec(), overrunCount);
+    else
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_VERBOSE, "Ticks: %llu, average %.3f ms, max %.3f ms",
+            tickCount, getAverageTickMsec(), getMaxTickMsec());
+
+    tickCount = 0;
+    overrunCount = 0;
+    totalTickTime = Clock::duration::zero();
+    maxTickTime = Clock::duration::zero();
+}
@@ -0,0 +1,73 @@
+#ifndef OPENMW_TICKSCHEDULER_HPP
+#define OPENMW_TICKSCHEDULER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace mwmp
+{
+    /*
+        Decides how long the server's main loop can sleep between two iterations
+
+        Without a tick rate, the loop wakes up as soon as a datagram arrives or a timer becomes due.
+        With a tick rate, the loop runs at that fixed frequency and each tick is measured against
+        its share of a second, so overruns can be reported.
+    */
+    class TickScheduler
+    {
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        TickScheduler();
+
+        void setTickRate(unsigned int ticksPerSecond);
+        void setMaxIdleWait(unsigned int msec);
+
+        // Can be called from any thread to wake up a waiting main loop
+        void notify();
+
+        // Called by the main loop when a notification has turned into a packet, so it can stop
+        // looking out for one
+        void onPacketReceived();
+
+        void beginTick();
+        void endTick();
+
+        // Sleep until a notification arrives, the next fixed tick is due or msecUntilTimer elapses,
+        // with a negative msecUntilTimer meaning that no timer is pending; after a notification that
+        // hasn't produced a packet yet, the sleep is cut short to re-check for it
+        void wait(long msecUntilTimer);
+
+        unsigned int getTickRate() const;
+        unsigned long long getTickCount() const;
+        unsigned long long getOverrunCount() const;
+        double getAverageTickMsec() const;
+        double getMaxTickMsec() const;
+
+    private:
+        void logSummary();
+
+        std::mutex waitMutex;
+        std::condition_variable waitCondition;
+        bool isNotified;
+
+        // Until when a signalled datagram may still become a packet
+        Clock::time_point awaitingPacketUntil;
+
+        unsigned int tickRate;
+        Clock::duration tickInterval;
+        Clock::duration maxIdleWait;
+
+        Clock::time_point tickStart;
+        Clock::time_point nextTick;
+        Clock::time_point nextSummary;
+
+        unsigned long long tickCount;
+        unsigned long long overrunCount;
+        Clock::duration totalTickTime;
+        Clock::duration maxTickTime;
+    };
+}
+
+#endif //OPENMW_TICKSCHEDULER_HPP
@@ -0,0 +1,492 @@
+#include "WorldStore.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <boost/crc.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include <components/openmw-mp/TimedLog.hpp>
+
+using namespace std;
+
+static const char logMagic[] = "TES3MPWS";
+static const uint32_t logVersion = 1;
+static const size_t logHeaderSize = 8 + 4;
+
+// Logs smaller than this are never compacted, because rewriting them would barely save anything
+static const uint64_t minCompactionSize = 4 * 1024 * 1024;
+
+bool WorldStore::isOpened = false;
+string WorldStore::logPath;
+WorldStore::CategoryMap WorldStore::categories;
+
+ofstream WorldStore::logFile;
+uint64_t WorldStore::logSize = 0;
+uint64_t WorldStore::compactedSize = 0;
+
+thread WorldStore::writerThread;
+mutex WorldStore::writerMutex;
+condition_variable WorldStore::writerCondition;
+chrono::milliseconds WorldStore::flushInterval(1000);
+string WorldStore::pendingWrites;
+bool WorldStore::isFlushRequested = false;
+bool WorldStore::isStopping = false;
+
+static void writeUInt32(string &buffer, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        buffer += (char) ((value >> (i * 8)) & 0xFF);
+}
+
+static uint32_t readUInt32(const char *data)
+{
+    uint32_t value = 0;
+
+    for (int i = 0; i < 4; i++)
+        value |= (uint32_t) (unsigned char) data[i] << (i * 8);
+
+    return value;
+}
+
+static void writeString(string &buffer, const string &value)
+{
+    writeUInt32(buffer, (uint32_t) value.size());
+    buffer += value;
+}
+
+static bool readString(const string &body, size_t &offset, string &value)
+{
+    if (offset + 4 > body.size())
+        return false;
+
+    uint32_t length = readUInt32(&body[offset]);
+    offset += 4;
+
+    if (offset + length > body.size())
+        return false;
+
+    value.assign(body, offset, length);
+    offset += length;
+    return true;
+}
+
+static uint32_t getChecksum(const string &body)
+{
+    boost::crc_32_type crc;
+    crc.process_bytes(body.data(), body.size());
+    return crc.checksum();
+}
+
+bool WorldStore::open(const string &path, unsigned int flushIntervalMsec)
+{
+    if (isOpened)
+        close();
+
+    logPath = path;
+    flushInterval = chrono::milliseconds(max(flushIntervalMsec, 1u));
+    categories.clear();
+
+    LogState state = readLog(logPath, categories);
+
+    // The log is only ever replaced by renaming a complete copy over it, but if it has gone missing
+    // anyway, a copy left behind by an interrupted rewrite is the best we have
+    if (state == LOG_MISSING)
+    {
+        bool isRecovered = false;
+
+        // Rewriting the log from nothing would overwrite the copy we failed to move
+        if (!recoverTemporaryLog(logPath, isRecovered))
+            return false;
+
+        if (isRecovered)
+            state = readLog(logPath, categories);
+    }
+
+    // Never overwrite a file we don't recognize, since the path might point at something else
+    if (state == LOG_UNRECOGNIZED)
+    {
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "%s is not a world store log, so it was left untouched", logPath.c_str());
+        return false;
+    }
+
+    // A damaged or missing log gets rewritten from what could be read, so appending to it is safe
+    if (state != LOG_INTACT)
+    {
+        if (!writeCompactedLog(logPath, categories, logSize))
+        {
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Could not write world store to %s", logPath.c_str());
+            return false;
+        }
+    }
+    else
+    {
+        ifstream file(logPath, ios::binary | ios::ate);
+        logSize = (uint64_t) file.tellg();
+    }
+
+    compactedSize = logSize;
+
+    logFile.open(logPath, ios::binary | ios::app);
+
+    if (!logFile)
+    {
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Could not open world store %s for writing", logPath.c_str());
+        return false;
+    }
+
+    size_t keyCount = 0;
+
+    for (const auto &category : categories)
+        keyCount += category.second.size();
+
+    LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Loaded world store %s with %u keys in %u categories", logPath.c_str(),
+        (unsigned) keyCount, (unsigned) categories.size());
+
+    isStopping = false;
+    isFlushRequested = false;
+    isOpened = true;
+
+    writerThread = thread(&WorldStore::runWriter);
+    return true;
+}
+
+void WorldStore::close()
+{
+    if (!isOpened)
+        return;
+
+    {
+        lock_guard<mutex> lock(writerMutex);
+        isStopping = true;
+    }
+
+    writerCondition.notify_one();
+    writerThread.join();
+
+    logFile.close();
+    isOpened = false;
+}
+
+bool WorldStore::isOpen()
+{
+    return isOpened;
+}
+
+bool WorldStore::has(const string &category, const string &key)
+{
+    return get(category, key) != nullptr;
+}
+
+const string *WorldStore::get(const string &category, const string &key)
+{
+    auto categoryIt = categories.find(category);
+
+    if (categoryIt == categories.end())
+        return nullptr;
+
+    auto it = categoryIt->second.find(key);
+
+    if (it == categoryIt->second.end())
+        return nullptr;
+
+    return &it->second;
+}
+
+void WorldStore::set(const string &category, const string &key, const string &value)
+{
+    auto &entries = categories[category];
+    auto it = entries.find(key);
+
+    if (it != entries.end() && it->second == value)
+        return;
+
+    entries[key] = value;
+    appendRecord(RECORD_SET, category, key, value);
+}
+
+void WorldStore::remove(const string &category, const string &key)
+{
+    auto categoryIt = categories.find(category);
+
+    if (categoryIt == categories.end() || categoryIt->second.erase(key) == 0)
+        return;
+
+    if (categoryIt->second.empty())
+        categories.erase(categoryIt);
+
+    appendRecord(RECORD_REMOVE, category, key, "");
+}
+
+vector<string> WorldStore::getKeys(const string &category)
+{
+    vector<string> keys;
+    auto categoryIt = categories.find(category);
+
+    if (categoryIt != categories.end())
+    {
+        keys.reserve(categoryIt->second.size());
+
+        for (const auto &entry : categoryIt->second)
+            keys.push_back(entry.first);
+    }
+
+    return keys;
+}
+
+void WorldStore::flush()
+{
+    if (!isOpened)
+        return;
+
+    {
+        lock_guard<mutex> lock(writerMutex);
+        isFlushRequested = true;
+    }
+
+    writerCondition.notify_one();
+}
+
+void WorldStore::appendRecord(RecordType type, const string &category, const string &key, const string &value)
+{
+    if (!isOpened)
+        return;
+
+    lock_guard<mutex> lock(writerMutex);
+    encodeRecord(pendingWrites, type, category, key, value);
+}
+
+void WorldStore::encodeRecord(string &buffer, RecordType type, const string &category, const string &key,
+    const string &value)
+{
+    string body;
+    body.reserve(1 + 12 + category.size() + key.size() + value.size());
+    body += (char) type;
+    writeString(body, category);
+    writeString(body, key);
+    writeString(body, value);
+
+    writeUInt32(buffer, (uint32_t) body.size());
+    writeUInt32(buffer, getChecksum(body));
+    buffer += body;
+}
+
+WorldStore::LogState WorldStore::readLog(const string &path, CategoryMap &result)
+{
+    ifstream file(path, ios::binary);
+
+    if (!file)
+        return LOG_MISSING;
+
+    file.seekg(0, ios::end);
+    uint64_t fileSize = (uint64_t) file.tellg();
+    file.seekg(0, ios::beg);
+
+    char header[logHeaderSize];
+
+    if (!file.read(header, logHeaderSize) || memcmp(header, logMagic, 8) != 0 ||
+        readUInt32(&header[8]) != logVersion)
+        return fileSize == 0 ? LOG_MISSING : LOG_UNRECOGNIZED;
+
+    char recordHeader[8];
+    string body;
+    string category, key, value;
+
+    while (file.read(recordHeader, 8))
+    {
+        uint32_t length = readUInt32(recordHeader);
+        uint32_t checksum = readUInt32(&recordHeader[4]);
+
+        // Check the length before using it, since a damaged one could be anything
+        if (length == 0 || (uint64_t) file.tellg() + length > fileSize)
+        {
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Dropping a damaged record at the end of world store %s", path.c_str());
+            return LOG_DAMAGED;
+        }
+
+        body.resize(length);
+
+        if (!file.read(&body[0], length) || getChecksum(body) != checksum)
+        {
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Dropping a damaged record at the end of world store %s", path.c_str());
+            return LOG_DAMAGED;
+        }
+
+        size_t offset = 1;
+
+        if (!readString(body, offset, category) || !readString(body, offset, key) ||
+            !readString(body, offset, value))
+            return LOG_DAMAGED;
+
+        if (body[0] == RECORD_SET)
+            result[category][key] = value;
+        else if (body[0] == RECORD_REMOVE)
+        {
+            auto categoryIt = result.find(category);
+
+            if (categoryIt != result.end())
+            {
+                categoryIt->second.erase(key);
+
+                if (categoryIt->second.empty())
+                    result.erase(categoryIt);
+            }
+        }
+    }
+
+    // Anything left over is the start of a record header that was never completed
+    return file.gcount() == 0 ? LOG_INTACT : LOG_DAMAGED;
+}
+
+bool WorldStore::recoverTemporaryLog(const string &path, bool &isRecovered)
+{
+    string temporaryPath = getTemporaryPath(path);
+    CategoryMap data;
+    LogState state = readLog(temporaryPath, data);
+
+    isRecovered = false;
+
+    if (state == LOG_MISSING || state == LOG_UNRECOGNIZED)
+        return true;
+
+    boost::system::error_code error;
+    boost::filesystem::rename(temporaryPath, path, error);
+
+    if (error)
+    {
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Could not recover world store %s from %s: %s", path.c_str(),
+            temporaryPath.c_str(), error.message().c_str());
+        return false;
+    }
+
+    LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Recovered world store %s from %s", path.c_str(), temporaryPath.c_str());
+    isRecovered = true;
+    return true;
+}
+
+string WorldStore::getTemporaryPath(const string &path)
+{
+    return path + ".tmp";
+}
+
+bool WorldStore::writeCompactedLog(const string &path, const CategoryMap &data, uint64_t &size)
+{
+    // Write to a temporary file first and rename it over the log, which replaces the log in one step,
+    // so a crash leaves either the old log or the new one in place
+    string temporaryPath = getTemporaryPath(path);
+
+    {
+        ofstream file(temporaryPath, ios::binary | ios::trunc);
+
+        if (!file)
+            return false;
+
+        string buffer;
+        buffer.append(logMagic, 8);
+        writeUInt32(buffer, logVersion);
+
+        for (const auto &category : data)
+        {
+            for (const auto &entry : category.second)
+            {
+                encodeRecord(buffer, RECORD_SET, category.first, entry.first, entry.second);
+
+                if (buffer.size() >= 65536)
+                {
+                    file.write(buffer.data(), buffer.size());
+                    buffer.clear();
+                }
+            }
+        }
+
+        file.write(buffer.data(), buffer.size());
+        size = (uint64_t) file.tellp();
+
+        if (!file)
+            return false;
+    }
+
+    boost::system::error_code error;
+    boost::filesystem::rename(temporaryPath, path, error);
+
+    if (error)
+    {
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Could not replace world store %s with %s: %s", path.c_str(),
+            temporaryPath.c_str(), error.message().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void WorldStore::runWriter()
+{
+    unique_lock<mutex> lock(writerMutex);
+
+    while (true)
+    {
+        writerCondition.wait_for(lock, flushInterval, []() { return isStopping || isFlushRequested; });
+
+        string buffer;
+        buffer.swap(pendingWrites);
+        isFlushRequested = false;
+        bool shouldStop = isStopping;
+
+        lock.unlock();
+
+        if (!buffer.empty())
+        {
+            logFile.write(buffer.data(), buffer.size());
+            logFile.flush();
+            logSize += buffer.size();
+
+            if (!logFile)
+                LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Could not write %u bytes to world store %s",
+                    (unsigned) buffer.size(), logPath.c_str());
+        }
+
+        if (!shouldStop && logSize >= minCompactionSize && logSize >= compactedSize * 2)
+            compact();
+
+        lock.lock();
+
+        if (shouldStop && pendingWrites.empty())
+            return;
+    }
+}
+
+void WorldStore::compact()
+{
+    chrono::steady_clock::time_point startTime = chrono::steady_clock::now();
+
+    // Everything written so far is in the log, so it can be replayed here without involving the
+    // main thread, whose later changes just wait in the buffer until we are done
+    CategoryMap data;
+    readLog(logPath, data);
+
+    uint64_t newSize = 0;
+
+    // The old log stays open until it has been replaced, so a failed rewrite leaves us appending to it as before
+    if (!writeCompactedLog(logPath, data, newSize))
+    {
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Could not compact world store %s", logPath.c_str());
+
+        // Don't try again until the log has doubled once more
+        compactedSize = logSize;
+        return;
+    }
+
+    logFile.close();
+    logFile.open(logPath, ios::binary | ios::app);
+
+    if (!logFile)
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Could not reopen world store %s for writing", logPath.c_str());
+
+    LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Compacted world store %s from %llu to %llu bytes in %lld ms", logPath.c_str(),
+        (unsigned long long) logSize, (unsigned long long) newSize,
+        (long long) chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count());
+
+    logSize = newSize;
+    compactedSize = newSize;
+}
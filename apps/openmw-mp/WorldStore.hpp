@@ -0,0 +1,98 @@
+#ifndef OPENMW_WORLDSTORE_HPP
+#define OPENMW_WORLDSTORE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+    Keeps string values that scripts store for players, cells, records or anything else, grouped
+    by category and key, and persists them in an append-only log file
+
+    Every change only appends a small record to a buffer on the main thread, which a writer thread
+    appends to the log every flush interval. Once the log has grown to twice the size it had after
+    its last compaction, the writer thread rewrites it with only the current value of every key.
+    A record that was cut short by a crash is dropped the next time the log is opened.
+*/
+class WorldStore
+{
+public:
+    typedef std::map<std::string, std::map<std::string, std::string>> CategoryMap;
+
+    // Load the log at this path, creating it if needed, and start writing changes to it
+    static bool open(const std::string &path, unsigned int flushIntervalMsec);
+
+    // Write every remaining change and stop the writer thread
+    static void close();
+
+    static bool isOpen();
+
+    static bool has(const std::string &category, const std::string &key);
+    static const std::string *get(const std::string &category, const std::string &key);
+    static void set(const std::string &category, const std::string &key, const std::string &value);
+    static void remove(const std::string &category, const std::string &key);
+
+    static std::vector<std::string> getKeys(const std::string &category);
+
+    // Have the writer thread write the changes so far right away instead of at its next interval
+    static void flush();
+
+private:
+    enum LogState
+    {
+        LOG_INTACT,
+        LOG_MISSING,
+        // Part of the log could be read, but it ends in a record that was cut short or corrupted
+        LOG_DAMAGED,
+        LOG_UNRECOGNIZED
+    };
+
+    enum RecordType : unsigned char
+    {
+        RECORD_SET = 1,
+        RECORD_REMOVE = 2
+    };
+
+    static void appendRecord(RecordType type, const std::string &category, const std::string &key,
+        const std::string &value);
+
+    static void encodeRecord(std::string &buffer, RecordType type, const std::string &category,
+        const std::string &key, const std::string &value);
+
+    // Replay as much of a log into the categories as is intact
+    static LogState readLog(const std::string &path, CategoryMap &result);
+    static bool writeCompactedLog(const std::string &path, const CategoryMap &data, uint64_t &size);
+
+    // Move a copy left behind by an interrupted rewrite into place, if there is a readable one,
+    // returning false if there is one that could not be moved
+    static bool recoverTemporaryLog(const std::string &path, bool &isRecovered);
+    static std::string getTemporaryPath(const std::string &path);
+
+    static void runWriter();
+    static void compact();
+
+    static bool isOpened;
+    static std::string logPath;
+    static CategoryMap categories;
+
+    // Only touched by the writer thread once it has started
+    static std::ofstream logFile;
+    static uint64_t logSize;
+    static uint64_t compactedSize;
+
+    static std::thread writerThread;
+    static std::mutex writerMutex;
+    static std::condition_variable writerCondition;
+    static std::chrono::milliseconds flushInterval;
+    static std::string pendingWrites;
+    static bool isFlushRequested;
+    static bool isStopping;
+};
+
+#endif //OPENMW_WORLDSTORE_HPP
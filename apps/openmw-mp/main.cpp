@@ -21,6 +21,9 @@
 #include <RakPeerInterface.h>
 
 #include "Player.hpp"
+#include "InterestManager.hpp"
+#include "PacketProfiler.hpp"
+#include "WorldStore.hpp"
 #include "Networking.hpp"
 #include "MasterClient.hpp"
 #include "Utils.hpp"
@@ -187,7 +190,7 @@ int main(int argc, char *argv[])
         std::cerr.rdbuf(&cerrsb);
     }
 
-    LOG_INIT(logLevel);
+    LOG_INIT_ASYNC(logLevel);
 
     int players = mgr.getInt("maximumPlayers", "General");
     string address = mgr.getString("localAddress", "General");
@@ -236,6 +239,18 @@ int main(int argc, char *argv[])
 
     try
     {
+        // Open the world store before loading scripts, so its values are there for their callbacks
+        if (mgr.getBool("enabled", "Storage"))
+        {
+            int flushInterval = mgr.getInt("flushInterval", "Storage");
+
+            if (flushInterval < 1)
+                flushInterval = 1;
+
+            WorldStore::open(Utils::convertPath(dataDirectory + "/" + mgr.getString("file", "Storage")),
+                (unsigned) flushInterval);
+        }
+
         for (auto plugin : plugins)
             Script::LoadScript(plugin.c_str(), pluginHome.c_str());
 
@@ -266,6 +281,33 @@ int main(int argc, char *argv[])
         Networking networking(peer);
         networking.setServerPassword(password);
 
+        int tickRate = mgr.getInt("tickRate", "General");
+        int maximumIdleWait = mgr.getInt("maximumIdleWait", "General");
+        int packetDecodeThreads = mgr.getInt("packetDecodeThreads", "General");
+
+        if (tickRate < 0)
+            tickRate = 0;
+        if (maximumIdleWait < 1)
+            maximumIdleWait = 1;
+        if (packetDecodeThreads < 0)
+            packetDecodeThreads = 0;
+
+        networking.getTickScheduler().setTickRate((unsigned) tickRate);
+        networking.getTickScheduler().setMaxIdleWait((unsigned) maximumIdleWait);
+        networking.getPacketDecoder().start((unsigned) packetDecodeThreads);
+
+        int profilingSummaryInterval = mgr.getInt("summaryInterval", "Profiling");
+
+        if (profilingSummaryInterval < 1)
+            profilingSummaryInterval = 1;
+
+        PacketProfiler::setEnabled(mgr.getBool("enabled", "Profiling"));
+        PacketProfiler::setSummaryInterval((unsigned) profilingSummaryInterval);
+        PacketProfiler::setStatsFile(mgr.getString("statsFile", "Profiling"));
+
+        InterestManager::setEnabled(mgr.getBool("enabled", "InterestManagement"));
+        InterestManager::loadRelevance("playerPosition", mgr.getString("playerPosition", "InterestManagement"));
+
         if (mgr.getBool("enabled", "MasterServer"))
         {
             LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Sharing server query info to master enabled.");
@@ -303,11 +345,13 @@ int main(int argc, char *argv[])
         code = networking.mainLoop();
 
         networking.getMasterClient()->Stop();
+        WorldStore::close();
     }
     catch (std::exception &e)
     {
         LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, e.what());
         Script::Call<Script::CallbackIdentity("OnServerScriptCrash")>(e.what());
+        WorldStore::close();
         throw; //fall through
     }
 
@@ -1,5 +1,6 @@
 #include "ActorProcessor.hpp"
 #include "Networking.hpp"
+#include "PacketProfiler.hpp"
 
 using namespace mwmp;
 
@@ -11,33 +12,97 @@ void ActorProcessor::Do(ActorPacket &packet, Player &player, BaseActorList &acto
     packet.Send(true);
 }
 
+void ActorProcessor::Relay(RakNet::Packet &packet, ActorPacket &actorPacket, Player &player, BaseActorList &actorList)
+{
+
+}
+
 bool ActorProcessor::Process(RakNet::Packet &packet, BaseActorList &actorList) noexcept
+{
+    PacketProfiler::Clock::time_point decodeStart = PacketProfiler::Clock::now();
+
+    if (!Decode(packet, *Networking::get().getActorPacketController(), actorList))
+        return false;
+
+    PacketProfiler::recordDecode(packet.data[0], PacketProfiler::Clock::now() - decodeStart);
+
+    return Dispatch(packet, actorList);
+}
+
+bool ActorProcessor::Decode(RakNet::Packet &packet, ActorPacketController &controller, BaseActorList &actorList) noexcept
 {
     // Clear our BaseActorList before loading new data in it
     actorList.cell.blank();
     actorList.baseActors.clear();
     actorList.guid = packet.guid;
 
-    for (auto &processor : processors)
-    {
-        if (processor.first == packet.data[0])
-        {
-            Player *player = Players::getPlayer(packet.guid);
-            ActorPacket *myPacket = Networking::get().getActorPacketController()->GetPacket(packet.data[0]);
+    auto processor = processors.find(packet.data[0]);
+
+    if (processor == processors.end())
+        return false;
+
+    ActorPacket *myPacket = controller.GetPacket(packet.data[0]);
+
+    myPacket->setActorList(&actorList);
+    actorList.isValid = true;
+
+    if (isRelayed(*processor->second, *myPacket))
+        actorList.isValid = ReadRelayHeader(packet, *myPacket, actorList);
+    else if (!processor->second->avoidReading)
+        myPacket->Read();
+
+    return true;
+}
+
+bool ActorProcessor::Dispatch(RakNet::Packet &packet, BaseActorList &actorList) noexcept
+{
+    auto processor = processors.find(packet.data[0]);
+
+    if (processor == processors.end())
+        return false;
 
-            myPacket->setActorList(&actorList);
-            actorList.isValid = true;
+    Player *player = Players::getPlayer(packet.guid);
+    ActorPacket *myPacket = Networking::get().getActorPacketController()->GetPacket(packet.data[0]);
 
-            if (!processor.second->avoidReading)
-                myPacket->Read();
+    myPacket->setActorList(&actorList);
 
-            if (actorList.isValid)
-                processor.second->Do(*myPacket, *player, actorList);
-            else
-                LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Received %s that failed integrity check and was ignored!", processor.second->strPacketID.c_str());
+    if (actorList.isValid)
+    {
+        PacketProfiler::ProcessScope scope(packet.data[0], processor->second->strPacketID);
 
-            return true;
-        }
+        if (isRelayed(*processor->second, *myPacket))
+            processor->second->Relay(packet, *myPacket, *player, actorList);
+        else
+            processor->second->Do(*myPacket, *player, actorList);
     }
-    return false;
+    else
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Received %s that failed integrity check and was ignored!", processor->second->strPacketID.c_str());
+
+    return true;
+}
+
+bool ActorProcessor::isRelayed(const ActorProcessor &processor, const ActorPacket &actorPacket)
+{
+    return processor.relaysPayload && actorPacket.getActorBits() != 0;
+}
+
+bool ActorProcessor::ReadRelayHeader(RakNet::Packet &packet, ActorPacket &actorPacket, BaseActorList &actorList)
+{
+    // Use a stream that ends exactly where the packet does, so the size of the actors can be checked
+    RakNet::BitStream bsIn(&packet.data[1], packet.length - 1, false);
+    RakNet::RakNetGUID writtenGuid;
+
+    // The guid written in the packet is relayed along with everything else, so it has to be the sender's
+    if (!bsIn.Read(writtenGuid) || writtenGuid != packet.guid)
+        return false;
+
+    actorPacket.SetReadStream(&bsIn);
+    bool isValid = actorPacket.ReadHeader();
+    actorPacket.SetReadStream(nullptr);
+
+    uint64_t actorBits = (uint64_t) actorList.count * actorPacket.getActorBits();
+    uint64_t unreadBits = bsIn.GetNumberOfUnreadBits();
+
+    // Only the padding up to the next byte may come after the actors
+    return isValid && unreadBits >= actorBits && unreadBits < actorBits + 8;
 }
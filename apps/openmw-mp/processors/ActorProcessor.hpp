@@ -5,6 +5,7 @@
 #include <components/openmw-mp/Base/BasePacketProcessor.hpp>
 #include <components/openmw-mp/Packets/BasePacket.hpp>
 #include <components/openmw-mp/Packets/Actor/ActorPacket.hpp>
+#include <components/openmw-mp/Controllers/ActorPacketController.hpp>
 #include <components/openmw-mp/NetworkMessages.hpp>
 #include "Script/Script.hpp"
 #include "Player.hpp"
@@ -17,7 +18,28 @@ namespace mwmp
 
         virtual void Do(ActorPacket &packet, Player &player, BaseActorList &actorList);
 
+        // Used instead of Do() for packets that were only decoded up to their header, so their
+        // original bytes can be relayed through Cell::relayToLoaded()
+        virtual void Relay(RakNet::Packet &packet, ActorPacket &actorPacket, Player &player, BaseActorList &actorList);
+
         static bool Process(RakNet::Packet &packet, BaseActorList &actorList) noexcept;
+
+        // Read a packet into actorList using the packets of the given controller, which does not have
+        // to be the main thread's
+        static bool Decode(RakNet::Packet &packet, ActorPacketController &controller, BaseActorList &actorList) noexcept;
+
+        // Run the processor for a packet that has already been decoded into actorList
+        static bool Dispatch(RakNet::Packet &packet, BaseActorList &actorList) noexcept;
+
+    protected:
+        // Whether packets should only have their header decoded and then be passed to Relay(), which
+        // is done when every actor in them takes up the same number of bits, so their size can
+        // still be checked
+        bool relaysPayload = false;
+
+    private:
+        static bool isRelayed(const ActorProcessor &processor, const ActorPacket &actorPacket);
+        static bool ReadRelayHeader(RakNet::Packet &packet, ActorPacket &actorPacket, BaseActorList &actorList);
     };
 }
 
@@ -1,5 +1,6 @@
 #include "ObjectProcessor.hpp"
 #include "Networking.hpp"
+#include "PacketProfiler.hpp"
 
 using namespace mwmp;
 
@@ -12,32 +13,59 @@ void ObjectProcessor::Do(ObjectPacket &packet, Player &player, BaseObjectList &o
 }
 
 bool ObjectProcessor::Process(RakNet::Packet &packet, BaseObjectList &objectList) noexcept
+{
+    PacketProfiler::Clock::time_point decodeStart = PacketProfiler::Clock::now();
+
+    if (!Decode(packet, *Networking::get().getObjectPacketController(), objectList))
+        return false;
+
+    PacketProfiler::recordDecode(packet.data[0], PacketProfiler::Clock::now() - decodeStart);
+
+    return Dispatch(packet, objectList);
+}
+
+bool ObjectProcessor::Decode(RakNet::Packet &packet, ObjectPacketController &controller, BaseObjectList &objectList) noexcept
 {
     // Clear our BaseObjectList before loading new data in it
     objectList.cell.blank();
     objectList.baseObjects.clear();
     objectList.guid = packet.guid;
 
-    for (auto &processor : processors)
+    auto processor = processors.find(packet.data[0]);
+
+    if (processor == processors.end())
+        return false;
+
+    ObjectPacket *myPacket = controller.GetPacket(packet.data[0]);
+
+    myPacket->setObjectList(&objectList);
+    objectList.isValid = true;
+
+    if (!processor->second->avoidReading)
+        myPacket->Read();
+
+    return true;
+}
+
+bool ObjectProcessor::Dispatch(RakNet::Packet &packet, BaseObjectList &objectList) noexcept
+{
+    auto processor = processors.find(packet.data[0]);
+
+    if (processor == processors.end())
+        return false;
+
+    Player *player = Players::getPlayer(packet.guid);
+    ObjectPacket *myPacket = Networking::get().getObjectPacketController()->GetPacket(packet.data[0]);
+
+    myPacket->setObjectList(&objectList);
+
+    if (objectList.isValid)
     {
-        if (processor.first == packet.data[0])
-        {
-            Player *player = Players::getPlayer(packet.guid);
-            ObjectPacket *myPacket = Networking::get().getObjectPacketController()->GetPacket(packet.data[0]);
-
-            myPacket->setObjectList(&objectList);
-            objectList.isValid = true;
-
-            if (!processor.second->avoidReading)
-                myPacket->Read();
-
-            if (objectList.isValid)
-                processor.second->Do(*myPacket, *player, objectList);
-            else
-                LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Received %s that failed integrity check and was ignored!", processor.second->strPacketID.c_str());
-            
-            return true;
-        }
+        PacketProfiler::ProcessScope scope(packet.data[0], processor->second->strPacketID);
+        processor->second->Do(*myPacket, *player, objectList);
     }
-    return false;
+    else
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Received %s that failed integrity check and was ignored!", processor->second->strPacketID.c_str());
+
+    return true;
 }
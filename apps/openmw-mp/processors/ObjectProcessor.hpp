@@ -5,6 +5,7 @@
 #include <components/openmw-mp/Base/BasePacketProcessor.hpp>
 #include <components/openmw-mp/Packets/BasePacket.hpp>
 #include <components/openmw-mp/Packets/Object/ObjectPacket.hpp>
+#include <components/openmw-mp/Controllers/ObjectPacketController.hpp>
 #include <components/openmw-mp/NetworkMessages.hpp>
 #include "Script/Script.hpp"
 #include "Player.hpp"
@@ -18,6 +19,13 @@ namespace mwmp
         virtual void Do(ObjectPacket &packet, Player &player, BaseObjectList &objectList);
 
         static bool Process(RakNet::Packet &packet, BaseObjectList &objectList) noexcept;
+
+        // Read a packet into objectList using the packets of the given controller, which does not have
+        // to be the main thread's
+        static bool Decode(RakNet::Packet &packet, ObjectPacketController &controller, BaseObjectList &objectList) noexcept;
+
+        // Run the processor for a packet that has already been decoded into objectList
+        static bool Dispatch(RakNet::Packet &packet, BaseObjectList &objectList) noexcept;
     };
 }
 
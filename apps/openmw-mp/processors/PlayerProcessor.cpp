@@ -1,5 +1,6 @@
 #include "PlayerProcessor.hpp"
 #include "Networking.hpp"
+#include "PacketProfiler.hpp"
 
 using namespace mwmp;
 
@@ -17,11 +18,32 @@ bool PlayerProcessor::Process(RakNet::Packet &packet) noexcept
             myPacket->setPlayer(player);
 
             if (!processor.second->avoidReading)
+            {
+                PacketProfiler::Clock::time_point decodeStart = PacketProfiler::Clock::now();
                 myPacket->Read();
+                PacketProfiler::recordDecode(packet.data[0], PacketProfiler::Clock::now() - decodeStart);
+            }
 
+            PacketProfiler::ProcessScope scope(packet.data[0], processor.second->strPacketID);
             processor.second->Do(*myPacket, *player);
             return true;
         }
     }
     return false;
 }
+
+bool PlayerProcessor::Dispatch(RakNet::Packet &packet) noexcept
+{
+    auto processor = processors.find(packet.data[0]);
+
+    if (processor == processors.end())
+        return false;
+
+    Player *player = Players::getPlayer(packet.guid);
+    PlayerPacket *myPacket = Networking::get().getPlayerPacketController()->GetPacket(packet.data[0]);
+    myPacket->setPlayer(player);
+
+    PacketProfiler::ProcessScope scope(packet.data[0], processor->second->strPacketID);
+    processor->second->Do(*myPacket, *player);
+    return true;
+}
@@ -15,6 +15,9 @@ namespace mwmp
         virtual void Do(PlayerPacket &packet, Player &player) = 0;
 
         static bool Process(RakNet::Packet &packet) noexcept;
+
+        // Run the processor for a packet whose contents have already been read into its player
+        static bool Dispatch(RakNet::Packet &packet) noexcept;
     };
 }
 
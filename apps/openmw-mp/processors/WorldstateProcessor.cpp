@@ -1,5 +1,6 @@
 #include "WorldstateProcessor.hpp"
 #include "Networking.hpp"
+#include "PacketProfiler.hpp"
 
 using namespace mwmp;
 
@@ -26,10 +27,17 @@ bool WorldstateProcessor::Process(RakNet::Packet &packet, BaseWorldstate &worlds
             worldstate.isValid = true;
 
             if (!processor.second->avoidReading)
+            {
+                PacketProfiler::Clock::time_point decodeStart = PacketProfiler::Clock::now();
                 myPacket->Read();
+                PacketProfiler::recordDecode(packet.data[0], PacketProfiler::Clock::now() - decodeStart);
+            }
 
             if (worldstate.isValid)
+            {
+                PacketProfiler::ProcessScope scope(packet.data[0], processor.second->strPacketID);
                 processor.second->Do(*myPacket, *player, worldstate);
+            }
             else
                 LOG_MESSAGE_SIMPLE(TimedLog::LOG_ERROR, "Received %s that failed integrity check and was ignored!", processor.second->strPacketID.c_str());
             
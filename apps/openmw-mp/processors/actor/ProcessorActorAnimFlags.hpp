@@ -11,6 +11,16 @@ namespace mwmp
         ProcessorActorAnimFlags()
         {
             BPP_INIT(ID_ACTOR_ANIM_FLAGS)
+            relaysPayload = true;
+        }
+
+        void Relay(RakNet::Packet &packet, ActorPacket &actorPacket, Player &player, BaseActorList &actorList) override
+        {
+            // Send only to players who have the cell loaded
+            Cell *serverCell = CellController::get()->getCell(&actorList.cell);
+
+            if (serverCell != nullptr && *serverCell->getAuthority() == actorList.guid)
+                serverCell->relayToLoaded(packet, &actorPacket);
         }
 
         void Do(ActorPacket &packet, Player &player, BaseActorList &actorList) override
@@ -1,4 +1,7 @@
+#include <algorithm>
+
 #include "ActorList.hpp"
+#include "ActorSendRate.hpp"
 #include "Main.hpp"
 #include "Networking.hpp"
 #include "LocalPlayer.hpp"
@@ -131,9 +134,15 @@ void ActorList::addCellChangeActor(BaseActor baseActor)
 
 void ActorList::sendPositionActors()
 {
-    if (positionActors.size() > 0)
+    // Split the positions across several packets when there are many of them, so no single packet
+    // grows large enough to need splitting by RakNet
+    unsigned int maxActorsPerPacket = ActorSendRate::getMaxActorsPerPacket();
+
+    for (size_t start = 0; start < positionActors.size(); start += maxActorsPerPacket)
     {
-        baseActors = positionActors;
+        size_t end = std::min(start + maxActorsPerPacket, positionActors.size());
+
+        baseActors.assign(positionActors.begin() + start, positionActors.begin() + end);
         Main::get().getNetworking()->getActorPacket(ID_ACTOR_POSITION)->setActorList(this);
         Main::get().getNetworking()->getActorPacket(ID_ACTOR_POSITION)->Send();
     }
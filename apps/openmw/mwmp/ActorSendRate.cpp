@@ -0,0 +1,167 @@
+#include <algorithm>
+
+#include <RakNetStatistics.h>
+
+#include <components/misc/stringops.hpp>
+#include <components/openmw-mp/TimedLog.hpp>
+#include <components/settings/settings.hpp>
+
+#include "../mwbase/environment.hpp"
+
+#include "../mwmechanics/aisequence.hpp"
+#include "../mwmechanics/creaturestats.hpp"
+
+#include "../mwworld/cellstore.hpp"
+#include "../mwworld/class.hpp"
+#include "../mwworld/worldimp.hpp"
+
+#include "ActorSendRate.hpp"
+#include "Main.hpp"
+#include "Networking.hpp"
+#include "PlayerList.hpp"
+#include "DedicatedPlayer.hpp"
+
+using namespace mwmp;
+using namespace std;
+
+// How often the connection statistics are checked for congestion, in seconds
+static const float statisticsInterval = 0.5f;
+
+// Packet loss and bytes waiting in RakNet's send buffer above which we count as congested
+static const float packetLossLimit = 0.02f;
+static const double sendBufferLimit = 32768;
+
+// Speed in units per second from which an actor counts as moving as fast as it gets
+static const float fastSpeed = 300.f;
+
+std::vector<ActorSendRate::PlayerLocation> ActorSendRate::playerLocations;
+
+float ActorSendRate::backoff = 1.f;
+float ActorSendRate::statisticsTimer = 0.f;
+float ActorSendRate::positionBudget = 0.f;
+
+float ActorSendRate::minSendInterval = 0.025f;
+float ActorSendRate::maxSendInterval = 0.25f;
+float ActorSendRate::relevanceDistance = 4096.f;
+float ActorSendRate::maxPositionsPerSecond = 600.f;
+float ActorSendRate::maxBackoff = 8.f;
+unsigned int ActorSendRate::maxActorsPerPacket = 64;
+
+void ActorSendRate::loadSettings()
+{
+    minSendInterval = max(Settings::Manager::getFloat("minSendInterval", "Actors"), 0.f);
+    maxSendInterval = max(Settings::Manager::getFloat("maxSendInterval", "Actors"), minSendInterval);
+    relevanceDistance = max(Settings::Manager::getFloat("relevanceDistance", "Actors"), 1.f);
+    maxPositionsPerSecond = max(Settings::Manager::getFloat("maxPositionsPerSecond", "Actors"), 1.f);
+    maxBackoff = max(Settings::Manager::getFloat("maxBackoff", "Actors"), 1.f);
+    maxActorsPerPacket = (unsigned int) max(Settings::Manager::getInt("maxActorsPerPacket", "Actors"), 1);
+}
+
+void ActorSendRate::update(float dt)
+{
+    updatePlayerLocations();
+
+    statisticsTimer += dt;
+
+    if (statisticsTimer >= statisticsInterval)
+    {
+        statisticsTimer = 0;
+        updateBackoff();
+    }
+
+    // Let a tenth of a second's worth of positions build up at most, so a quiet moment can't be
+    // followed by a burst that fills the send buffer
+    float rate = maxPositionsPerSecond / backoff;
+    positionBudget = min(positionBudget + rate * dt, max(rate / 10, 1.f));
+}
+
+float ActorSendRate::getRelevance(const MWWorld::Ptr& ptr, float speed)
+{
+    const ESM::Cell *cell = ptr.getCell()->getCell();
+    osg::Vec3f position = ptr.getRefData().getPosition().asVec3();
+
+    float closestDistance = relevanceDistance;
+
+    for (const auto &location : playerLocations)
+    {
+        if (cell->isExterior() != location.isExterior)
+            continue;
+
+        if (!cell->isExterior() && !Misc::StringUtils::ciEqual(cell->mName, location.cellName))
+            continue;
+
+        closestDistance = min(closestDistance, (position - location.position).length());
+    }
+
+    float nearness = 1 - closestDistance / relevanceDistance;
+    float relevance = 0.5f * nearness + 0.25f * min(speed / fastSpeed, 1.f);
+
+    if (ptr.getClass().getCreatureStats(ptr).getAiSequence().isInCombat())
+        relevance += 0.5f;
+
+    return min(relevance, 1.f);
+}
+
+float ActorSendRate::getSendInterval(float relevance)
+{
+    return (minSendInterval + (maxSendInterval - minSendInterval) * (1 - relevance)) * backoff;
+}
+
+unsigned int ActorSendRate::takePositionBudget(unsigned int count)
+{
+    unsigned int allowed = min(count, (unsigned int) positionBudget);
+    positionBudget -= allowed;
+    return allowed;
+}
+
+unsigned int ActorSendRate::getMaxActorsPerPacket()
+{
+    return maxActorsPerPacket;
+}
+
+void ActorSendRate::updatePlayerLocations()
+{
+    playerLocations.clear();
+
+    MWWorld::Ptr playerPtr = MWBase::Environment::get().getWorld()->getPlayerPtr();
+    const ESM::Cell *playerCell = playerPtr.getCell()->getCell();
+    playerLocations.push_back({playerCell->isExterior(), playerCell->mName, playerPtr.getRefData().getPosition().asVec3()});
+
+    for (const auto &playerEntry : PlayerList::getPlayers())
+    {
+        DedicatedPlayer *player = playerEntry.second;
+
+        if (player == nullptr || player->reference == nullptr)
+            continue;
+
+        playerLocations.push_back({player->cell.isExterior(), player->cell.mName, player->position.asVec3()});
+    }
+}
+
+void ActorSendRate::updateBackoff()
+{
+    RakNet::RakNetStatistics statistics;
+
+    if (!Main::get().getNetworking()->getConnectionStatistics(statistics))
+        return;
+
+    double bytesInSendBuffer = 0;
+
+    for (int priority = 0; priority < NUMBER_OF_PRIORITIES; priority++)
+        bytesInSendBuffer += statistics.bytesInSendBuffer[priority];
+
+    bool isCongested = statistics.packetlossLastSecond > packetLossLimit || bytesInSendBuffer > sendBufferLimit ||
+        statistics.isLimitedByCongestionControl;
+
+    // Back off quickly when congested and recover slowly afterwards
+    float newBackoff = isCongested ? min(backoff * 2, maxBackoff) : max(backoff - 0.25f, 1.f);
+
+    if (newBackoff != backoff && (newBackoff == maxBackoff || newBackoff == 1.f))
+    {
+        LOG_MESSAGE_SIMPLE(TimedLog::LOG_VERBOSE, "Actor position sending is now %s, with packet loss %.3f and %.0f bytes waiting to be sent",
+            newBackoff == 1.f ? "back to its full rate" : "backed off as far as it goes", statistics.packetlossLastSecond,
+            bytesInSendBuffer);
+    }
+
+    backoff = newBackoff;
+}
@@ -0,0 +1,65 @@
+#ifndef OPENMW_ACTORSENDRATE_HPP
+#define OPENMW_ACTORSENDRATE_HPP
+
+#include <string>
+#include <vector>
+
+#include <osg/Vec3f>
+
+#include "../mwworld/ptr.hpp"
+
+namespace mwmp
+{
+    /*
+        Decides how often the positions of LocalActors are sent, so the client with authority over a
+        crowded cell doesn't saturate its upstream
+
+        Actors that are in combat, close to a player or moving fast are sent more often than the rest,
+        and every client only sends as many positions per second as its budget allows. That budget and
+        the send intervals both back off while RakNet reports packet loss or a filling send buffer.
+    */
+    class ActorSendRate
+    {
+    public:
+
+        static void loadSettings();
+
+        // Refresh the player locations, the connection statistics and the position budget
+        static void update(float dt);
+
+        // Get a relevance between 0 and 1 for an actor moving at the given speed in units per second
+        static float getRelevance(const MWWorld::Ptr& ptr, float speed);
+        static float getSendInterval(float relevance);
+
+        // Take up to the requested number of positions from the budget, returning how many can be sent
+        static unsigned int takePositionBudget(unsigned int count);
+
+        static unsigned int getMaxActorsPerPacket();
+
+    private:
+        struct PlayerLocation
+        {
+            bool isExterior;
+            std::string cellName;
+            osg::Vec3f position;
+        };
+
+        static void updatePlayerLocations();
+        static void updateBackoff();
+
+        static std::vector<PlayerLocation> playerLocations;
+
+        static float backoff;
+        static float statisticsTimer;
+        static float positionBudget;
+
+        static float minSendInterval;
+        static float maxSendInterval;
+        static float relevanceDistance;
+        static float maxPositionsPerSecond;
+        static float maxBackoff;
+        static unsigned int maxActorsPerPacket;
+    };
+}
+
+#endif //OPENMW_ACTORSENDRATE_HPP
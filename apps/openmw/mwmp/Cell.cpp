@@ -1,5 +1,8 @@
+#include <algorithm>
+
 #include <components/esm/cellid.hpp>
 #include <components/openmw-mp/TimedLog.hpp>
+#include <components/openmw-mp/Packets/Actor/PacketActorPosition.hpp>
 
 #include "../mwbase/environment.hpp"
 
@@ -8,6 +11,7 @@
 #include "../mwworld/worldimp.hpp"
 
 #include "Cell.hpp"
+#include "ActorSendRate.hpp"
 #include "Main.hpp"
 #include "Networking.hpp"
 #include "LocalPlayer.hpp"
@@ -21,9 +25,6 @@ mwmp::Cell::Cell(MWWorld::CellStore* cellStore)
     store = cellStore;
     shouldInitializeActors = false;
 
-    std::map<std::string, LocalActor *> localActors;
-    std::map<std::string, DedicatedActor *> dedicatedActors;
-
     updateTimer = 0;
 }
 
@@ -41,8 +42,9 @@ void Cell::updateLocal(bool forceUpdate)
 
     if (!forceUpdate && (updateTimer += MWBase::Environment::get().getFrameDuration()) < timeoutSec)
         return;
-    else
-        updateTimer = 0;
+
+    float elapsedTime = updateTimer;
+    updateTimer = 0;
 
     CellController *cellController = Main::get().getCellController();
     ActorList *actorList = mwmp::Main::get().getNetworking()->getActorList();
@@ -59,26 +61,26 @@ void Cell::updateLocal(bool forceUpdate)
         if (newStore != store)
         {
             actor->updateCell();
-            std::string mapIndex = it->first;
+            uint64_t actorKey = it->first;
 
             // If the cell this actor has moved to is under our authority, move them to it
             if (cellController->hasLocalAuthority(actor->cell))
             {
-                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Moving LocalActor %s to our authority in %s",
-                    mapIndex.c_str(), actor->cell.getDescription().c_str());
+                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Moving LocalActor %u-%u to our authority in %s",
+                    actor->refNum, actor->mpNum, actor->cell.getDescription().c_str());
                 Cell *newCell = cellController->getCell(actor->cell);
-                newCell->localActors[mapIndex] = actor;
-                cellController->setLocalActorRecord(mapIndex, newCell->getDescription());
+                newCell->localActors[actorKey] = actor;
+                cellController->setLocalActorRecord(actorKey, newCell);
             }
             else
             {
-                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Deleting LocalActor %s which is no longer under our authority",
-                    mapIndex.c_str(), getDescription().c_str());
-                cellController->removeLocalActorRecord(mapIndex);
+                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Deleting LocalActor %u-%u which is no longer under our authority",
+                    actor->refNum, actor->mpNum);
+                cellController->removeLocalActorRecord(actorKey);
                 delete actor;
             }
 
-            localActors.erase(it++);
+            it = localActors.erase(it);
         }
         else
         {
@@ -91,6 +93,8 @@ void Cell::updateLocal(bool forceUpdate)
         }
     }
 
+    sendPendingPositions(elapsedTime);
+
     actorList->sendPositionActors();
     actorList->sendAnimFlagsActors();
     actorList->sendAnimPlayActors();
@@ -103,6 +107,42 @@ void Cell::updateLocal(bool forceUpdate)
     actorList->sendCellChangeActors();
 }
 
+void Cell::sendPendingPositions(float elapsedTime)
+{
+    std::vector<std::pair<float, LocalActor *>> dueActors;
+
+    for (auto &actorEntry : localActors)
+    {
+        LocalActor *actor = actorEntry.second;
+        actor->positionTimer += elapsedTime;
+
+        if (!actor->hasPendingPosition)
+            continue;
+
+        float relevance = actor->getSendRelevance();
+        float sendInterval = ActorSendRate::getSendInterval(relevance);
+
+        if (actor->positionTimer < sendInterval)
+            continue;
+
+        // Put the most relevant actors first, while letting less relevant ones catch up the longer
+        // they have been waiting past their interval
+        float priority = (0.5f + relevance) * actor->positionTimer / sendInterval;
+        dueActors.emplace_back(priority, actor);
+    }
+
+    if (dueActors.empty())
+        return;
+
+    std::sort(dueActors.begin(), dueActors.end(), [](const std::pair<float, LocalActor *> &a,
+        const std::pair<float, LocalActor *> &b) { return a.first > b.first; });
+
+    unsigned int sendCount = ActorSendRate::takePositionBudget(dueActors.size());
+
+    for (unsigned int i = 0; i < sendCount; i++)
+        dueActors[i].second->sendPosition();
+}
+
 void Cell::updateDedicated(float dt)
 {
     if (dedicatedActors.empty()) return;
@@ -124,13 +164,19 @@ void Cell::readPositions(ActorList& actorList)
     
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        // Skip actors whose delta-encoded position could not be applied
+        if (!baseActor.hasPositionData) continue;
+
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        auto it = dedicatedActors.find(actorKey);
+
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->position = baseActor.position;
             actor->direction = baseActor.direction;
+            actor->addPositionSnapshot();
 
             if (!actor->hasPositionData)
             {
@@ -151,11 +197,13 @@ void Cell::readAnimFlags(ActorList& actorList)
 {
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
+
+        auto it = dedicatedActors.find(actorKey);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->movementFlags = baseActor.movementFlags;
             actor->drawState = baseActor.drawState;
             actor->isFlying = baseActor.isFlying;
@@ -167,11 +215,13 @@ void Cell::readAnimPlay(ActorList& actorList)
 {
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        auto it = dedicatedActors.find(actorKey);
+
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->animation.groupname = baseActor.animation.groupname;
             actor->animation.mode = baseActor.animation.mode;
             actor->animation.count = baseActor.animation.count;
@@ -189,11 +239,13 @@ void Cell::readStatsDynamic(ActorList& actorList)
 
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
+
+        auto it = dedicatedActors.find(actorKey);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->creatureStats = baseActor.creatureStats;
 
             if (!actor->hasStatsDynamicData)
@@ -227,11 +279,13 @@ void Cell::readEquipment(ActorList& actorList)
 
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
+
+        auto it = dedicatedActors.find(actorKey);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
 
             for (int slot = 0; slot < 19; ++slot)
                 actor->equipmentItems[slot] = baseActor.equipmentItems[slot];
@@ -252,11 +306,13 @@ void Cell::readSpeech(ActorList& actorList)
 
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        auto it = dedicatedActors.find(actorKey);
+
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->sound = baseActor.sound;
             actor->playSound();
         }
@@ -274,11 +330,13 @@ void Cell::readAi(ActorList& actorList)
 
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
+
+        auto it = dedicatedActors.find(actorKey);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->aiAction = baseActor.aiAction;
             actor->aiDistance = baseActor.aiDistance;
             actor->aiDuration = baseActor.aiDuration;
@@ -298,13 +356,15 @@ void Cell::readAttack(ActorList& actorList)
 {
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        auto it = dedicatedActors.find(actorKey);
+
+        if (it != dedicatedActors.end())
         {
-            LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Reading ActorAttack about %s", mapIndex.c_str());
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Reading ActorAttack about %u-%u", baseActor.refNum, baseActor.mpNum);
 
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->attack = baseActor.attack;
 
             // Set the correct drawState here if we've somehow we've missed a previous
@@ -325,13 +385,15 @@ void Cell::readCast(ActorList& actorList)
 {
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
+
+        auto it = dedicatedActors.find(actorKey);
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        if (it != dedicatedActors.end())
         {
-            LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Reading ActorCast about %s", mapIndex.c_str());
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "Reading ActorCast about %u-%u", baseActor.refNum, baseActor.mpNum);
 
-            DedicatedActor *actor = dedicatedActors[mapIndex];
+            DedicatedActor *actor = it->second;
             actor->cast = baseActor.cast;
 
             // Set the correct drawState here if we've somehow we've missed a previous
@@ -358,25 +420,27 @@ void Cell::readCellChange(ActorList& actorList)
 
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
 
         // Is a packet mistakenly moving the actor to the cell it's already in? If so, ignore it
         if (Misc::StringUtils::ciEqual(getDescription(), baseActor.cell.getDescription()))
         {
-            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Server says DedicatedActor %s moved to %s, but it was already there",
-                mapIndex.c_str(), getDescription().c_str());
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_WARN, "Server says DedicatedActor %u-%u moved to %s, but it was already there",
+                baseActor.refNum, baseActor.mpNum, getDescription().c_str());
             continue;
         }
 
-        if (dedicatedActors.count(mapIndex) > 0)
+        auto it = dedicatedActors.find(actorKey);
+
+        if (it != dedicatedActors.end())
         {
-            DedicatedActor *dedicatedActor = dedicatedActors[mapIndex];
+            DedicatedActor *dedicatedActor = it->second;
             dedicatedActor->cell = baseActor.cell;
             dedicatedActor->position = baseActor.position;
             dedicatedActor->direction = baseActor.direction;
 
-            LOG_MESSAGE_SIMPLE(TimedLog::LOG_VERBOSE, "Server says DedicatedActor %s moved to %s",
-                mapIndex.c_str(), dedicatedActor->cell.getDescription().c_str());
+            LOG_MESSAGE_SIMPLE(TimedLog::LOG_VERBOSE, "Server says DedicatedActor %u-%u moved to %s",
+                baseActor.refNum, baseActor.mpNum, dedicatedActor->cell.getDescription().c_str());
 
             MWWorld::CellStore *newStore = cellController->getCellStore(dedicatedActor->cell);
             dedicatedActor->setCell(newStore);
@@ -384,19 +448,19 @@ void Cell::readCellChange(ActorList& actorList)
             // If the cell this actor has moved to is active and not under our authority, move them to it
             if (cellController->isActiveWorldCell(dedicatedActor->cell) && !cellController->hasLocalAuthority(dedicatedActor->cell))
             {
-                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Moving DedicatedActor %s to our active cell %s",
-                    mapIndex.c_str(), dedicatedActor->cell.getDescription().c_str());
+                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Moving DedicatedActor %u-%u to our active cell %s",
+                    baseActor.refNum, baseActor.mpNum, dedicatedActor->cell.getDescription().c_str());
                 cellController->initializeCell(dedicatedActor->cell);
                 Cell *newCell = cellController->getCell(dedicatedActor->cell);
-                newCell->dedicatedActors[mapIndex] = dedicatedActor;
-                cellController->setDedicatedActorRecord(mapIndex, newCell->getDescription());
+                newCell->dedicatedActors[actorKey] = dedicatedActor;
+                cellController->setDedicatedActorRecord(actorKey, newCell);
             }
             else
             {
                 if (cellController->hasLocalAuthority(dedicatedActor->cell))
                 {
-                    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Creating new LocalActor based on %s in %s",
-                        mapIndex.c_str(), dedicatedActor->cell.getDescription().c_str());
+                    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Creating new LocalActor based on %u-%u in %s",
+                        baseActor.refNum, baseActor.mpNum, dedicatedActor->cell.getDescription().c_str());
                     Cell *newCell = cellController->getCell(dedicatedActor->cell);
                     LocalActor *localActor = new LocalActor();
                     localActor->cell = dedicatedActor->cell;
@@ -408,25 +472,26 @@ void Cell::readCellChange(ActorList& actorList)
                     localActor->isFlying = dedicatedActor->isFlying;
                     localActor->creatureStats = dedicatedActor->creatureStats;
 
-                    newCell->localActors[mapIndex] = localActor;
-                    cellController->setLocalActorRecord(mapIndex, newCell->getDescription());
+                    newCell->localActors[actorKey] = localActor;
+                    cellController->setLocalActorRecord(actorKey, newCell);
                 }
 
-                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Deleting DedicatedActor %s which is no longer needed",
-                    mapIndex.c_str(), getDescription().c_str());
-                cellController->removeDedicatedActorRecord(mapIndex);
+                LOG_APPEND(TimedLog::LOG_VERBOSE, "- Deleting DedicatedActor %u-%u which is no longer needed",
+                    baseActor.refNum, baseActor.mpNum);
+                cellController->removeDedicatedActorRecord(actorKey);
                 delete dedicatedActor;
             }
 
-            dedicatedActors.erase(mapIndex);
+            dedicatedActors.erase(it);
         }
     }
 }
 
 void Cell::initializeLocalActor(const MWWorld::Ptr& ptr)
 {
-    std::string mapIndex = Main::get().getCellController()->generateMapIndex(ptr);
-    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Initializing LocalActor %s in %s", mapIndex.c_str(), getDescription().c_str());
+    uint64_t actorKey = CellController::generateActorKey(ptr);
+    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Initializing LocalActor %u-%u in %s", ptr.getCellRef().getRefNum().mIndex,
+        ptr.getCellRef().getMpNum(), getDescription().c_str());
 
     LocalActor *actor = new LocalActor();
     actor->cell = *store->getCell();
@@ -437,11 +502,12 @@ void Cell::initializeLocalActor(const MWWorld::Ptr& ptr)
     if (ptr.getClass().getCreatureStats(ptr).isDead())
         actor->wasDead = true;
 
-    localActors[mapIndex] = actor;
+    localActors[actorKey] = actor;
 
-    Main::get().getCellController()->setLocalActorRecord(mapIndex, getDescription());
+    Main::get().getCellController()->setLocalActorRecord(actorKey, this);
 
-    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Successfully initialized LocalActor %s in %s", mapIndex.c_str(), getDescription().c_str());
+    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Successfully initialized LocalActor %u-%u in %s", actor->refNum, actor->mpNum,
+        getDescription().c_str());
 }
 
 void Cell::initializeLocalActors()
@@ -457,10 +523,10 @@ void Cell::initializeLocalActors()
             // If this Ptr is lacking a unique index, ignore it
             if (ptr.getCellRef().getRefNum().mIndex == 0 && ptr.getCellRef().getMpNum() == 0) continue;
 
-            std::string mapIndex = Main::get().getCellController()->generateMapIndex(ptr);
+            uint64_t actorKey = CellController::generateActorKey(ptr);
 
             // Only initialize this actor if it isn't already initialized
-            if (localActors.count(mapIndex) == 0)
+            if (localActors.count(actorKey) == 0)
                 initializeLocalActor(ptr);
         }
     }
@@ -470,28 +536,30 @@ void Cell::initializeLocalActors()
 
 void Cell::initializeDedicatedActor(const MWWorld::Ptr& ptr)
 {
-    std::string mapIndex = Main::get().getCellController()->generateMapIndex(ptr);
-    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Initializing DedicatedActor %s in %s", mapIndex.c_str(), getDescription().c_str());
+    uint64_t actorKey = CellController::generateActorKey(ptr);
+    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Initializing DedicatedActor %u-%u in %s", ptr.getCellRef().getRefNum().mIndex,
+        ptr.getCellRef().getMpNum(), getDescription().c_str());
 
     DedicatedActor *actor = new DedicatedActor();
     actor->cell = *store->getCell();
     actor->setPtr(ptr);
 
-    dedicatedActors[mapIndex] = actor;
+    dedicatedActors[actorKey] = actor;
 
-    Main::get().getCellController()->setDedicatedActorRecord(mapIndex, getDescription());
+    Main::get().getCellController()->setDedicatedActorRecord(actorKey, this);
 
-    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Successfully initialized DedicatedActor %s in %s", mapIndex.c_str(), getDescription().c_str());
+    LOG_APPEND(TimedLog::LOG_VERBOSE, "- Successfully initialized DedicatedActor %u-%u in %s", actor->refNum, actor->mpNum,
+        getDescription().c_str());
 }
 
 void Cell::initializeDedicatedActors(ActorList& actorList)
 {
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
 
         // If this key doesn't exist, create it
-        if (dedicatedActors.count(mapIndex) == 0)
+        if (dedicatedActors.count(actorKey) == 0)
         {
             MWWorld::Ptr ptrFound = store->searchExact(baseActor.refNum, baseActor.mpNum);
 
@@ -517,10 +585,10 @@ void Cell::uninitializeDedicatedActors(ActorList& actorList)
 {
     for (const auto &baseActor : actorList.baseActors)
     {
-        std::string mapIndex = Main::get().getCellController()->generateMapIndex(baseActor);
-        Main::get().getCellController()->removeDedicatedActorRecord(mapIndex);
-        delete dedicatedActors.at(mapIndex);
-        dedicatedActors.erase(mapIndex);
+        uint64_t actorKey = CellController::generateActorKey(baseActor);
+        Main::get().getCellController()->removeDedicatedActorRecord(actorKey);
+        delete dedicatedActors.at(actorKey);
+        dedicatedActors.erase(actorKey);
     }
 }
 
@@ -535,14 +603,27 @@ void Cell::uninitializeDedicatedActors()
     dedicatedActors.clear();
 }
 
-LocalActor *Cell::getLocalActor(std::string actorIndex)
+void Cell::forgetActorPositions()
+{
+    // Packets from the server are read without a connection, as it is the only one we have
+    PacketActorPosition *actorPositionPacket =
+        static_cast<PacketActorPosition *>(Main::get().getNetworking()->getActorPacket(ID_ACTOR_POSITION));
+
+    for (const auto &actor : localActors)
+        actorPositionPacket->forgetActor(RakNet::UNASSIGNED_CRABNET_GUID, actor.second->refNum, actor.second->mpNum);
+
+    for (const auto &actor : dedicatedActors)
+        actorPositionPacket->forgetActor(RakNet::UNASSIGNED_CRABNET_GUID, actor.second->refNum, actor.second->mpNum);
+}
+
+LocalActor *Cell::getLocalActor(uint64_t actorKey)
 {
-    return localActors.at(actorIndex);
+    return localActors.at(actorKey);
 }
 
-DedicatedActor *Cell::getDedicatedActor(std::string actorIndex)
+DedicatedActor *Cell::getDedicatedActor(uint64_t actorKey)
 {
-    return dedicatedActors.at(actorIndex);
+    return dedicatedActors.at(actorKey);
 }
 
 bool Cell::hasLocalAuthority()
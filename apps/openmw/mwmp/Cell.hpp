@@ -1,6 +1,8 @@
 #ifndef OPENMW_MPCELL_HPP
 #define OPENMW_MPCELL_HPP
 
+#include <unordered_map>
+
 #include "ActorList.hpp"
 #include "LocalActor.hpp"
 #include "DedicatedActor.hpp"
@@ -18,6 +20,9 @@ namespace mwmp
         void updateLocal(bool forceUpdate);
         void updateDedicated(float dt);
 
+        // Send the positions of the LocalActors that are due for one, as far as ActorSendRate allows
+        void sendPendingPositions(float elapsedTime);
+
         void readPositions(ActorList& actorList);
         void readAnimFlags(ActorList& actorList);
         void readAnimPlay(ActorList& actorList);
@@ -39,8 +44,12 @@ namespace mwmp
         void uninitializeDedicatedActors(ActorList& actorList);
         void uninitializeDedicatedActors();
 
-        virtual LocalActor *getLocalActor(std::string actorIndex);
-        virtual DedicatedActor *getDedicatedActor(std::string actorIndex);
+        // Drop the positions last received for this cell's actors, which the server stops sending
+        // once the cell is unloaded
+        void forgetActorPositions();
+
+        virtual LocalActor *getLocalActor(uint64_t actorKey);
+        virtual DedicatedActor *getDedicatedActor(uint64_t actorKey);
 
         bool hasLocalAuthority();
         void setAuthority(const RakNet::RakNetGUID& guid);
@@ -54,8 +63,9 @@ namespace mwmp
         MWWorld::CellStore* store;
         RakNet::RakNetGUID authorityGuid;
 
-        std::map<std::string, LocalActor *> localActors;
-        std::map<std::string, DedicatedActor *> dedicatedActors;
+        // Keyed by CellController::generateActorKey()
+        std::unordered_map<uint64_t, LocalActor *> localActors;
+        std::unordered_map<uint64_t, DedicatedActor *> dedicatedActors;
 
         float updateTimer;
     };
@@ -9,14 +9,15 @@
 #include "../mwworld/worldimp.hpp"
 
 #include "CellController.hpp"
+#include "ActorSendRate.hpp"
 #include "Main.hpp"
 #include "LocalActor.hpp"
 #include "LocalPlayer.hpp"
 using namespace mwmp;
 
 std::map<std::string, mwmp::Cell *> CellController::cellsInitialized;
-std::map<std::string, std::string> CellController::localActorsToCells;
-std::map<std::string, std::string> CellController::dedicatedActorsToCells;
+std::unordered_map<uint64_t, mwmp::Cell *> CellController::localActorsToCells;
+std::unordered_map<uint64_t, mwmp::Cell *> CellController::dedicatedActorsToCells;
 
 mwmp::CellController::CellController()
 {
@@ -30,6 +31,8 @@ CellController::~CellController()
 
 void CellController::updateLocal(bool forceUpdate)
 {
+    ActorSendRate::update(MWBase::Environment::get().getFrameDuration());
+
     // Loop through Cells, deleting inactive ones and updating LocalActors in active ones
     for (auto it = cellsInitialized.begin(); it != cellsInitialized.end();)
     {
@@ -37,6 +40,7 @@ void CellController::updateLocal(bool forceUpdate)
 
         if (!MWBase::Environment::get().getWorld()->isCellActive(*mpCell->getCellStore()->getCell()))
         {
+            mpCell->forgetActorPositions();
             mpCell->uninitializeLocalActors();
             mpCell->uninitializeDedicatedActors();
             delete it->second;
@@ -200,14 +204,14 @@ void CellController::readCellChange(ActorList& actorList)
         cellsInitialized[mapIndex]->readCellChange(actorList);
 }
 
-void CellController::setLocalActorRecord(std::string actorIndex, std::string cellIndex)
+void CellController::setLocalActorRecord(uint64_t actorKey, Cell *cell)
 {
-    localActorsToCells[actorIndex] = cellIndex;
+    localActorsToCells[actorKey] = cell;
 }
 
-void CellController::removeLocalActorRecord(std::string actorIndex)
+void CellController::removeLocalActorRecord(uint64_t actorKey)
 {
-    localActorsToCells.erase(actorIndex);
+    localActorsToCells.erase(actorKey);
 }
 
 bool CellController::isLocalActor(MWWorld::Ptr ptr)
@@ -215,42 +219,36 @@ bool CellController::isLocalActor(MWWorld::Ptr ptr)
     if (ptr.mRef == nullptr)
         return false;
 
-    std::string actorIndex = generateMapIndex(ptr);
-
-    return localActorsToCells.count(actorIndex) > 0;
+    return localActorsToCells.count(generateActorKey(ptr)) > 0;
 }
 
 bool CellController::isLocalActor(int refNum, int mpNum)
 {
-    std::string actorIndex = generateMapIndex(refNum, mpNum);
-
-    return localActorsToCells.count(actorIndex) > 0;
+    return localActorsToCells.count(generateActorKey(refNum, mpNum)) > 0;
 }
 
 LocalActor *CellController::getLocalActor(MWWorld::Ptr ptr)
 {
-    std::string actorIndex = generateMapIndex(ptr);
-    std::string cellIndex = localActorsToCells.at(actorIndex);
+    uint64_t actorKey = generateActorKey(ptr);
 
-    return cellsInitialized.at(cellIndex)->getLocalActor(actorIndex);
+    return localActorsToCells.at(actorKey)->getLocalActor(actorKey);
 }
 
 LocalActor *CellController::getLocalActor(int refNum, int mpNum)
 {
-    std::string actorIndex = generateMapIndex(refNum, mpNum);
-    std::string cellIndex = localActorsToCells.at(actorIndex);
+    uint64_t actorKey = generateActorKey(refNum, mpNum);
 
-    return cellsInitialized.at(cellIndex)->getLocalActor(actorIndex);
+    return localActorsToCells.at(actorKey)->getLocalActor(actorKey);
 }
 
-void CellController::setDedicatedActorRecord(std::string actorIndex, std::string cellIndex)
+void CellController::setDedicatedActorRecord(uint64_t actorKey, Cell *cell)
 {
-    dedicatedActorsToCells[actorIndex] = cellIndex;
+    dedicatedActorsToCells[actorKey] = cell;
 }
 
-void CellController::removeDedicatedActorRecord(std::string actorIndex)
+void CellController::removeDedicatedActorRecord(uint64_t actorKey)
 {
-    dedicatedActorsToCells.erase(actorIndex);
+    dedicatedActorsToCells.erase(actorKey);
 }
 
 bool CellController::isDedicatedActor(MWWorld::Ptr ptr)
@@ -258,49 +256,41 @@ bool CellController::isDedicatedActor(MWWorld::Ptr ptr)
     if (ptr.mRef == nullptr)
         return false;
 
-    std::string actorIndex = generateMapIndex(ptr);
-
-    return dedicatedActorsToCells.count(actorIndex) > 0;
+    return dedicatedActorsToCells.count(generateActorKey(ptr)) > 0;
 }
 
 bool CellController::isDedicatedActor(int refNum, int mpNum)
 {
-    std::string actorIndex = generateMapIndex(refNum, mpNum);
-
-    return dedicatedActorsToCells.count(actorIndex) > 0;
+    return dedicatedActorsToCells.count(generateActorKey(refNum, mpNum)) > 0;
 }
 
 DedicatedActor *CellController::getDedicatedActor(MWWorld::Ptr ptr)
 {
-    std::string actorIndex = generateMapIndex(ptr);
-    std::string cellIndex = dedicatedActorsToCells.at(actorIndex);
+    uint64_t actorKey = generateActorKey(ptr);
 
-    return cellsInitialized.at(cellIndex)->getDedicatedActor(actorIndex);
+    return dedicatedActorsToCells.at(actorKey)->getDedicatedActor(actorKey);
 }
 
 DedicatedActor *CellController::getDedicatedActor(int refNum, int mpNum)
 {
-    std::string actorIndex = generateMapIndex(refNum, mpNum);
-    std::string cellIndex = dedicatedActorsToCells.at(actorIndex);
+    uint64_t actorKey = generateActorKey(refNum, mpNum);
 
-    return cellsInitialized.at(cellIndex)->getDedicatedActor(actorIndex);
+    return dedicatedActorsToCells.at(actorKey)->getDedicatedActor(actorKey);
 }
 
-std::string CellController::generateMapIndex(int refNum, int mpNum)
+uint64_t CellController::generateActorKey(unsigned int refNum, unsigned int mpNum)
 {
-    std::string mapIndex = "";
-    mapIndex = Utils::toString(refNum) + "-" + Utils::toString(mpNum);
-    return mapIndex;
+    return (static_cast<uint64_t>(refNum) << 32) | mpNum;
 }
 
-std::string CellController::generateMapIndex(MWWorld::Ptr ptr)
+uint64_t CellController::generateActorKey(const MWWorld::Ptr& ptr)
 {
-    return generateMapIndex(ptr.getCellRef().getRefNum().mIndex, ptr.getCellRef().getMpNum());
+    return generateActorKey(ptr.getCellRef().getRefNum().mIndex, ptr.getCellRef().getMpNum());
 }
 
-std::string CellController::generateMapIndex(BaseActor baseActor)
+uint64_t CellController::generateActorKey(const BaseActor& baseActor)
 {
-    return generateMapIndex(baseActor.refNum, baseActor.mpNum);
+    return generateActorKey(baseActor.refNum, baseActor.mpNum);
 }
 
 bool CellController::hasLocalAuthority(const ESM::Cell& cell)
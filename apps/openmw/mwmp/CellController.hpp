@@ -1,6 +1,8 @@
 #ifndef OPENMW_CELLCONTROLLER_HPP
 #define OPENMW_CELLCONTROLLER_HPP
 
+#include <unordered_map>
+
 #include "Cell.hpp"
 #include "ActorList.hpp"
 #include "LocalActor.hpp"
@@ -32,25 +34,26 @@ namespace mwmp
         void readCast(mwmp::ActorList& actorList);
         void readCellChange(mwmp::ActorList& actorList);
 
-        void setLocalActorRecord(std::string actorIndex, std::string cellIndex);
-        void removeLocalActorRecord(std::string actorIndex);
+        void setLocalActorRecord(uint64_t actorKey, Cell *cell);
+        void removeLocalActorRecord(uint64_t actorKey);
         
         bool isLocalActor(MWWorld::Ptr ptr);
         bool isLocalActor(int refNum, int mpNum);
         virtual LocalActor *getLocalActor(MWWorld::Ptr ptr);
         virtual LocalActor *getLocalActor(int refNum, int mpNum);
 
-        void setDedicatedActorRecord(std::string actorIndex, std::string cellIndex);
-        void removeDedicatedActorRecord(std::string actorIndex);
+        void setDedicatedActorRecord(uint64_t actorKey, Cell *cell);
+        void removeDedicatedActorRecord(uint64_t actorKey);
         
         bool isDedicatedActor(MWWorld::Ptr ptr);
         bool isDedicatedActor(int refNum, int mpNum);
         virtual DedicatedActor *getDedicatedActor(MWWorld::Ptr ptr);
         virtual DedicatedActor *getDedicatedActor(int refNum, int mpNum);
 
-        std::string generateMapIndex(int refNumindex, int mpNum);
-        std::string generateMapIndex(MWWorld::Ptr ptr);
-        std::string generateMapIndex(mwmp::BaseActor baseActor);
+        // Pack an actor's refNum and mpNum into a single key for the actor registries
+        static uint64_t generateActorKey(unsigned int refNum, unsigned int mpNum);
+        static uint64_t generateActorKey(const MWWorld::Ptr& ptr);
+        static uint64_t generateActorKey(const mwmp::BaseActor& baseActor);
 
         bool hasLocalAuthority(const ESM::Cell& cell);
         bool isInitializedCell(const std::string& cellDescription);
@@ -66,8 +69,9 @@ namespace mwmp
 
     private:
         static std::map<std::string, mwmp::Cell *> cellsInitialized;
-        static std::map<std::string, std::string> localActorsToCells;
-        static std::map<std::string, std::string> dedicatedActorsToCells;
+        // The Cells currently holding each LocalActor and DedicatedActor
+        static std::unordered_map<uint64_t, mwmp::Cell *> localActorsToCells;
+        static std::unordered_map<uint64_t, mwmp::Cell *> dedicatedActorsToCells;
     };
 }
 
@@ -71,39 +71,28 @@ void DedicatedActor::setCell(MWWorld::CellStore *cellStore)
 
     ptr = world->moveObject(ptr, cellStore, position.pos[0], position.pos[1], position.pos[2]);
     setMovementSettings();
+    snapshotBuffer.reset(position);
 
     hasChangedCell = true;
 }
 
 void DedicatedActor::move(float dt)
 {
-    ESM::Position refPos = ptr.getRefData().getPosition();
     MWBase::World *world = MWBase::Environment::get().getWorld();
-    const int maxInterpolationDistance = 40;
+    ESM::Position playoutPosition = position;
 
-    // Apply interpolation only if the position hasn't changed too much from last time
-    bool shouldInterpolate = abs(position.pos[0] - refPos.pos[0]) < maxInterpolationDistance && abs(position.pos[1] - refPos.pos[1]) < maxInterpolationDistance && abs(position.pos[2] - refPos.pos[2]) < maxInterpolationDistance;
-
-    // Don't apply linear interpolation if the DedicatedActor has just gone through a cell change, because
-    // the interpolated position will be invalid, causing a slight hopping glitch
-    if (shouldInterpolate && !hasChangedCell)
-    {
-        static const int timeMultiplier = 15;
-        osg::Vec3f lerp = MechanicsHelper::getLinearInterpolation(refPos.asVec3(), position.asVec3(), dt * timeMultiplier);
-        refPos.pos[0] = lerp.x();
-        refPos.pos[1] = lerp.y();
-        refPos.pos[2] = lerp.z();
-
-        world->moveObject(ptr, refPos.pos[0], refPos.pos[1], refPos.pos[2]);
-    }
-    else
+    // Don't play back buffered positions if the DedicatedActor has just gone through a cell change,
+    // because they will be invalid, causing a slight hopping glitch
+    if (hasChangedCell)
     {
         setPosition();
         hasChangedCell = false;
     }
+    else if (snapshotBuffer.sample(playoutPosition))
+        world->moveObject(ptr, playoutPosition.pos[0], playoutPosition.pos[1], playoutPosition.pos[2]);
 
     setMovementSettings();
-    world->rotateObject(ptr, position.rot[0], position.rot[1], position.rot[2]);
+    world->rotateObject(ptr, playoutPosition.rot[0], playoutPosition.rot[1], playoutPosition.rot[2]);
 }
 
 void DedicatedActor::setMovementSettings()
@@ -126,6 +115,13 @@ void DedicatedActor::setPosition()
 {
     MWBase::World *world = MWBase::Environment::get().getWorld();
     world->moveObject(ptr, position.pos[0], position.pos[1], position.pos[2]);
+
+    snapshotBuffer.reset(position);
+}
+
+void DedicatedActor::addPositionSnapshot()
+{
+    snapshotBuffer.addSnapshot(position);
 }
 
 void DedicatedActor::setAnimFlags()
@@ -372,4 +368,6 @@ void DedicatedActor::setPtr(const MWWorld::Ptr& newPtr)
 
     position = ptr.getRefData().getPosition();
     drawState = ptr.getClass().getCreatureStats(ptr).getDrawState();
+
+    snapshotBuffer.reset(position);
 }
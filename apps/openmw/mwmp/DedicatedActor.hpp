@@ -5,6 +5,8 @@
 #include "../mwmechanics/aisequence.hpp"
 #include "../mwworld/manualref.hpp"
 
+#include "SnapshotBuffer.hpp"
+
 namespace mwmp
 {
     class DedicatedActor : public BaseActor
@@ -19,6 +21,7 @@ namespace mwmp
         void setCell(MWWorld::CellStore *cellStore);
         void setMovementSettings();
         void setPosition();
+        void addPositionSnapshot();
         void setAnimFlags();
         void setStatsDynamic();
         void setEquipment();
@@ -34,6 +37,7 @@ namespace mwmp
 
     private:
         MWWorld::Ptr ptr;
+        SnapshotBuffer snapshotBuffer;
 
         bool hasChangedCell;
     };
@@ -116,27 +116,13 @@ void DedicatedPlayer::move(float dt)
 {
     if (!reference) return;
 
-    ESM::Position refPos = ptr.getRefData().getPosition();
     MWBase::World *world = MWBase::Environment::get().getWorld();
-    const int maxInterpolationDistance = 40;
+    ESM::Position playoutPosition = position;
 
-    // Apply interpolation only if the position hasn't changed too much from last time
-    bool shouldInterpolate =
-            abs(position.pos[0] - refPos.pos[0]) < maxInterpolationDistance &&
-            abs(position.pos[1] - refPos.pos[1]) < maxInterpolationDistance &&
-            abs(position.pos[2] - refPos.pos[2]) < maxInterpolationDistance;
+    snapshotBuffer.sample(playoutPosition);
 
-    if (shouldInterpolate)
-    {
-        static const int timeMultiplier = 15;
-        osg::Vec3f lerp = MechanicsHelper::getLinearInterpolation(refPos.asVec3(), position.asVec3(), dt * timeMultiplier);
-
-        world->moveObject(ptr, lerp.x(), lerp.y(), lerp.z());
-    }
-    else
-        world->moveObject(ptr, position.pos[0], position.pos[1], position.pos[2]);
-
-    world->rotateObject(ptr, position.rot[0], 0, position.rot[2]);
+    world->moveObject(ptr, playoutPosition.pos[0], playoutPosition.pos[1], playoutPosition.pos[2]);
+    world->rotateObject(ptr, playoutPosition.rot[0], 0, playoutPosition.rot[2]);
 
     MWMechanics::Movement *move = &ptr.getClass().getMovementSettings(ptr);
     move->mPosition[0] = direction.pos[0];
@@ -152,6 +138,11 @@ void DedicatedPlayer::move(float dt)
     }
 }
 
+void DedicatedPlayer::addPositionSnapshot()
+{
+    snapshotBuffer.addSnapshot(position);
+}
+
 void DedicatedPlayer::setBaseInfo()
 {
     // Use the previous race if the new one doesn't exist
@@ -381,6 +372,7 @@ void DedicatedPlayer::setCell()
     // Allow this player's reference to move across a cell now that a manual cell
     // update has been called
     setPtr(world->moveObject(ptr, cellStore, position.pos[0], position.pos[1], position.pos[2]));
+    snapshotBuffer.reset(position);
 
     // Remove the marker entirely if this player has moved to an interior that is inactive for us
     if (!cell.isExterior() && !Main::get().getCellController()->isActiveWorldCell(cell))
@@ -475,6 +467,7 @@ void DedicatedPlayer::createReference(const std::string& recId)
     LOG_APPEND(TimedLog::LOG_INFO, "- Creating new reference pointer for %s", npc.mName.c_str());
 
     ptr = world->placeObject(reference->getPtr(), Main::get().getCellController()->getCellStore(cell), position);
+    snapshotBuffer.reset(position);
 
     ESM::CustomMarker mEditingMarker = Main::get().getGUIController()->createMarker(guid);
     marker = mEditingMarker;
@@ -12,6 +12,8 @@
 
 #include "../mwworld/manualref.hpp"
 
+#include "SnapshotBuffer.hpp"
+
 #include <map>
 #include <RakNetTypes.h>
 
@@ -33,6 +35,7 @@ namespace mwmp
         void update(float dt);
 
         void move(float dt);
+        void addPositionSnapshot();
         void setBaseInfo();
         void setShapeshift();
         void setAnimFlags();
@@ -65,6 +68,7 @@ namespace mwmp
         MWWorld::ManualRef* reference;
 
         MWWorld::Ptr ptr;
+        SnapshotBuffer snapshotBuffer;
 
         ESM::CustomMarker marker;
         bool markerEnabled;
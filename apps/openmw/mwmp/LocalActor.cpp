@@ -15,6 +15,7 @@
 #include "Main.hpp"
 #include "Networking.hpp"
 #include "ActorList.hpp"
+#include "ActorSendRate.hpp"
 #include "MechanicsHelper.hpp"
 
 using namespace mwmp;
@@ -23,6 +24,8 @@ using namespace std;
 LocalActor::LocalActor()
 {
     hasSentData = false;
+    hasPendingPosition = false;
+    positionTimer = 0;
     posWasChanged = false;
     equipmentChanged = false;
 
@@ -94,9 +97,20 @@ void LocalActor::updatePosition(bool forceUpdate)
     if (forceUpdate || posIsChanging || posWasChanged)
     {
         posWasChanged = posIsChanging;
-        position = ptr.getRefData().getPosition();
-        mwmp::Main::get().getNetworking()->getActorList()->addPositionActor(*this);
+        hasPendingPosition = true;
     }
+
+    // Positions that aren't forced are sent by our Cell once ActorSendRate allows it
+    if (forceUpdate)
+        sendPosition();
+}
+
+void LocalActor::sendPosition()
+{
+    hasPendingPosition = false;
+    positionTimer = 0;
+    position = ptr.getRefData().getPosition();
+    mwmp::Main::get().getNetworking()->getActorList()->addPositionActor(*this);
 }
 
 void LocalActor::updateAnimFlags(bool forceUpdate)
@@ -275,6 +289,17 @@ MWWorld::Ptr LocalActor::getPtr()
     return ptr;
 }
 
+float LocalActor::getSendRelevance()
+{
+    // Use the distance covered since the last sent position to tell how fast this actor is moving
+    float speed = 0;
+
+    if (positionTimer > 0)
+        speed = (ptr.getRefData().getPosition().asVec3() - position.asVec3()).length() / positionTimer;
+
+    return ActorSendRate::getRelevance(ptr, speed);
+}
+
 void LocalActor::setPtr(const MWWorld::Ptr& newPtr)
 {
     ptr = newPtr;
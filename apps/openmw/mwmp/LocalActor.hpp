@@ -18,6 +18,7 @@ namespace mwmp
 
         void updateCell();
         void updatePosition(bool forceUpdate);
+        void sendPosition();
         void updateAnimFlags(bool forceUpdate);
         void updateAnimPlay();
         void updateSpeech();
@@ -28,9 +29,16 @@ namespace mwmp
         MWWorld::Ptr getPtr();
         void setPtr(const MWWorld::Ptr& newPtr);
 
+        // Get how relevant this actor's position currently is to players, as used by ActorSendRate
+        float getSendRelevance();
+
         bool hasSentData;
         bool wasDead;
 
+        // Whether this actor has moved since its position was last sent, and how long ago that was
+        bool hasPendingPosition;
+        float positionTimer;
+
     private:
         MWWorld::Ptr ptr;
 
@@ -36,6 +36,7 @@
 #include "../mwworld/worldimp.hpp"
 
 #include "Main.hpp"
+#include "ActorSendRate.hpp"
 #include "Networking.hpp"
 #include "LocalSystem.hpp"
 #include "LocalPlayer.hpp"
@@ -44,6 +45,7 @@
 #include "GUIController.hpp"
 #include "CellController.hpp"
 #include "MechanicsHelper.hpp"
+#include "SnapshotBuffer.hpp"
 
 using namespace mwmp;
 using namespace std;
@@ -132,6 +134,9 @@ bool Main::init(std::vector<std::string> &content, Files::Collections &collectio
 
     int logLevel = manager.getInt("logLevel", "General");
     TimedLog::SetLevel(logLevel);
+
+    SnapshotBuffer::loadSettings();
+    ActorSendRate::loadSettings();
     if (address.empty())
     {
         pMain->server = manager.getString("destinationAddress", "General");
@@ -503,6 +503,11 @@ Worldstate *Networking::getWorldstate()
     return &worldstate;
 }
 
+bool Networking::getConnectionStatistics(RakNet::RakNetStatistics &statistics)
+{
+    return peer->GetStatistics(serverAddr, &statistics) != nullptr;
+}
+
 bool Networking::isConnected()
 {
     return connected;
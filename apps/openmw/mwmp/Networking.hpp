@@ -2,6 +2,7 @@
 #define OPENMW_NETWORKING_HPP
 
 #include <RakPeerInterface.h>
+#include <RakNetStatistics.h>
 #include <BitStream.h>
 #include <string>
 
@@ -45,6 +46,9 @@ namespace mwmp
 
         bool isConnected();
 
+        // Get RakNet's statistics for our connection to the server, returning false if there is none
+        bool getConnectionStatistics(RakNet::RakNetStatistics &statistics);
+
         LocalSystem *getLocalSystem();
         LocalPlayer *getLocalPlayer();
         ActorList *getActorList();
@@ -1,4 +1,5 @@
 #include <components/openmw-mp/TimedLog.hpp>
+#include <components/openmw-mp/Packets/Player/PacketPlayerPosition.hpp>
 #include <apps/openmw/mwclass/creature.hpp>
 
 #include "../mwbase/environment.hpp"
@@ -13,6 +14,7 @@
 
 #include "PlayerList.hpp"
 #include "Main.hpp"
+#include "Networking.hpp"
 #include "DedicatedPlayer.hpp"
 #include "CellController.hpp"
 #include "GUIController.hpp"
@@ -52,6 +54,10 @@ void PlayerList::deletePlayer(RakNet::RakNetGUID guid)
 
     delete playerList[guid];
     playerList.erase(guid);
+
+    // Packets from the server are read without a connection, as it is the only one we have
+    static_cast<PacketPlayerPosition *>(Main::get().getNetworking()->getPlayerPacket(ID_PLAYER_POSITION))->forgetPlayer(
+        RakNet::UNASSIGNED_CRABNET_GUID, guid);
 }
 
 void PlayerList::cleanUp()
@@ -81,6 +87,11 @@ DedicatedPlayer *PlayerList::getPlayer(const MWWorld::Ptr &ptr)
     return nullptr;
 }
 
+const std::map<RakNet::RakNetGUID, DedicatedPlayer *> &PlayerList::getPlayers()
+{
+    return playerList;
+}
+
 bool PlayerList::isDedicatedPlayer(const MWWorld::Ptr &ptr)
 {
     if (ptr.mRef == nullptr)
@@ -37,6 +37,8 @@ namespace mwmp
 
         static bool isDedicatedPlayer(const MWWorld::Ptr &ptr);
 
+        static const std::map<RakNet::RakNetGUID, DedicatedPlayer *> &getPlayers();
+
         static void enableMarkers(const ESM::Cell& cell);
 
         static void clearHitAttemptActorId(int actorId);
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cmath>
+
+#include <osg/Math>
+
+#include <components/settings/settings.hpp>
+
+#include "SnapshotBuffer.hpp"
+
+using namespace mwmp;
+using namespace std;
+
+// Beyond this many snapshots, the oldest ones are dropped even if the playout time hasn't reached them
+static const size_t maxSnapshots = 64;
+
+SnapshotBuffer::Clock::duration SnapshotBuffer::playoutDelay = chrono::milliseconds(100);
+SnapshotBuffer::Clock::duration SnapshotBuffer::maxExtrapolation = chrono::milliseconds(250);
+float SnapshotBuffer::teleportDistance = 1000;
+
+SnapshotBuffer::SnapshotBuffer() : averageInterval(Clock::duration::zero())
+{
+
+}
+
+void SnapshotBuffer::loadSettings()
+{
+    float delay = Settings::Manager::getFloat("playoutDelay", "Interpolation");
+    float extrapolation = Settings::Manager::getFloat("maxExtrapolation", "Interpolation");
+
+    playoutDelay = chrono::duration_cast<Clock::duration>(chrono::duration<float>(max(delay, 0.f)));
+    maxExtrapolation = chrono::duration_cast<Clock::duration>(chrono::duration<float>(max(extrapolation, 0.f)));
+    teleportDistance = Settings::Manager::getFloat("teleportDistance", "Interpolation");
+}
+
+void SnapshotBuffer::addSnapshot(const ESM::Position &position)
+{
+    Clock::time_point now = Clock::now();
+
+    if (snapshots.empty() || (position.asVec3() - snapshots.back().position.asVec3()).length() > teleportDistance)
+    {
+        reset(position);
+        return;
+    }
+
+    Clock::duration interval = now - lastArrival;
+
+    if (averageInterval == Clock::duration::zero())
+        averageInterval = interval;
+    else
+        averageInterval = (averageInterval * 7 + interval) / 8;
+
+    lastArrival = now;
+
+    // Snapshots that arrive together were usually sent apart, so give them some room, but never
+    // hold one back for so long that the playout time could reach it before it is due
+    Clock::time_point time = max(now, min(snapshots.back().time + averageInterval / 2, now + playoutDelay / 2));
+
+    snapshots.push_back({time, position});
+
+    Clock::time_point playoutTime = now - playoutDelay;
+
+    while (snapshots.size() > maxSnapshots || (snapshots.size() > 2 && snapshots[1].time <= playoutTime))
+        snapshots.pop_front();
+}
+
+void SnapshotBuffer::reset(const ESM::Position &position)
+{
+    lastArrival = Clock::now();
+    averageInterval = Clock::duration::zero();
+
+    snapshots.clear();
+    snapshots.push_back({lastArrival, position});
+}
+
+bool SnapshotBuffer::sample(ESM::Position &result) const
+{
+    if (snapshots.empty())
+        return false;
+
+    Clock::time_point playoutTime = Clock::now() - playoutDelay;
+
+    if (snapshots.size() == 1 || playoutTime <= snapshots.front().time)
+    {
+        result = snapshots.front().position;
+        return true;
+    }
+
+    for (size_t i = 0; i + 1 < snapshots.size(); i++)
+    {
+        if (playoutTime < snapshots[i + 1].time)
+        {
+            interpolate(snapshots[i], snapshots[i + 1], playoutTime, result);
+            return true;
+        }
+    }
+
+    // We've run out of snapshots, so keep moving the way the last two went for a while
+    const Snapshot &last = snapshots.back();
+    playoutTime = min(playoutTime, last.time + maxExtrapolation);
+
+    interpolate(snapshots[snapshots.size() - 2], last, playoutTime, result);
+    return true;
+}
+
+void SnapshotBuffer::interpolate(const Snapshot &start, const Snapshot &end, Clock::time_point time,
+    ESM::Position &result)
+{
+    double span = chrono::duration<double>(end.time - start.time).count();
+
+    if (span <= 0)
+    {
+        result = end.position;
+        return;
+    }
+
+    float percent = static_cast<float>(chrono::duration<double>(time - start.time).count() / span);
+
+    for (int i = 0; i < 3; i++)
+    {
+        result.pos[i] = start.position.pos[i] + (end.position.pos[i] - start.position.pos[i]) * percent;
+
+        // Turn the shorter way around
+        float rotation = end.position.rot[i] - start.position.rot[i];
+        rotation = std::remainder(rotation, 2 * osg::PIf);
+
+        result.rot[i] = start.position.rot[i] + rotation * percent;
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef OPENMW_SNAPSHOTBUFFER_HPP
+#define OPENMW_SNAPSHOTBUFFER_HPP
+
+#include <chrono>
+#include <deque>
+
+#include <components/esm/defs.hpp>
+
+namespace mwmp
+{
+    /*
+        Keeps the last positions received for a DedicatedPlayer or DedicatedActor together with the
+        times they arrived at, and plays them back a fixed delay behind the present
+
+        The delay lets a position be interpolated between two received snapshots instead of chasing
+        the latest one, so uneven packet arrival doesn't show up as stuttering. When no newer snapshot
+        has arrived in time, movement is extrapolated from the last two for a limited time.
+    */
+    class SnapshotBuffer
+    {
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        SnapshotBuffer();
+
+        // Read the playout delay, extrapolation limit and teleport distance from the client settings
+        static void loadSettings();
+
+        void addSnapshot(const ESM::Position &position);
+
+        // Drop every snapshot, such as after a teleport, so the next one is used right away
+        void reset(const ESM::Position &position);
+
+        // Get the position at the current playout time, returning false if there are no snapshots
+        bool sample(ESM::Position &result) const;
+
+    private:
+        struct Snapshot
+        {
+            Clock::time_point time;
+            ESM::Position position;
+        };
+
+        static void interpolate(const Snapshot &start, const Snapshot &end, Clock::time_point time,
+            ESM::Position &result);
+
+        std::deque<Snapshot> snapshots;
+        Clock::time_point lastArrival;
+
+        // Smoothed time between received snapshots, used to spread out snapshots that arrive bunched up
+        Clock::duration averageInterval;
+
+        static Clock::duration playoutDelay;
+        static Clock::duration maxExtrapolation;
+        static float teleportDistance;
+    };
+}
+
+#endif //OPENMW_SNAPSHOTBUFFER_HPP
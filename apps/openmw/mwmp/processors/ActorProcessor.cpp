@@ -35,6 +35,10 @@ bool ActorProcessor::Process(RakNet::Packet &packet, ActorList &actorList)
             if (!request && !processor.second->avoidReading)
             {
                 myPacket->Read();
+
+                // Set when a string could not be read, such as a refId with an index we were never sent
+                if (!myPacket->isPacketValid())
+                    actorList.isValid = false;
             }
 
             if (actorList.isValid)
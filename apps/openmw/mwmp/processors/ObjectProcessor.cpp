@@ -34,8 +34,14 @@ bool ObjectProcessor::Process(RakNet::Packet &packet, ObjectList &objectList)
             objectList.isValid = true;
 
             if (!request && !processor.second->avoidReading)
+            {
                 myPacket->Read();
 
+                // Set when a string could not be read, such as a refId with an index we were never sent
+                if (!myPacket->isPacketValid())
+                    objectList.isValid = false;
+            }
+
             if (objectList.isValid)
                 processor.second->Do(*myPacket, objectList);
             else
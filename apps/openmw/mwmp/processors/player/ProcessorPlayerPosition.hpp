@@ -2,6 +2,8 @@
 #define OPENMW_PROCESSORPLAYERPOSITION_HPP
 
 
+#include <components/openmw-mp/Packets/Player/PacketPlayerPosition.hpp>
+
 #include "../PlayerProcessor.hpp"
 
 namespace mwmp
@@ -20,6 +22,10 @@ namespace mwmp
             {
                 if (!isRequest())
                 {
+                    // Without a base for the delta we don't know where the server wants us, so stay put
+                    if (!static_cast<PacketPlayerPosition&>(packet).hasPositionData())
+                        return;
+
                     LOG_MESSAGE_SIMPLE(TimedLog::LOG_INFO, "ID_PLAYER_POSITION changed by server");
 
                     static_cast<LocalPlayer*>(player)->setPosition();
@@ -28,7 +34,14 @@ namespace mwmp
                     static_cast<LocalPlayer*>(player)->updatePosition(true);
             }
             else if (player != 0) // dedicated player
+            {
+                // A delta we had no base for leaves the player where they are until the next keyframe
+                if (!static_cast<PacketPlayerPosition&>(packet).hasPositionData())
+                    return;
+
+                static_cast<DedicatedPlayer*>(player)->addPositionSnapshot();
                 static_cast<DedicatedPlayer*>(player)->updateMarker();
+            }
         }
     };
 }
@@ -391,6 +391,16 @@ namespace MWWorld
         forEachInternal(visitor);
         visitor.merge();
 
+        /*
+            Start of tes3mp addition
+
+            Keep the index used by searchExact() in sync with the merged refs
+        */
+        updateRefNumIndex();
+        /*
+            End of tes3mp addition
+        */
+
         /*
             Start of tes3mp addition
 
@@ -546,16 +556,77 @@ namespace MWWorld
         if (refNum == 0 && mpNum == 0)
             return 0;
 
+        if (mState != State_Loaded || mMergedRefs.empty())
+            return Ptr();
+
+        uint64_t key = getRefNumIndexKey(refNum, mpNum);
+        auto it = mRefNumIndex.find(key);
+
+        if (it != mRefNumIndex.end())
+        {
+            LiveCellRefBase *ref = it->second;
+
+            if (ref->mRef.getRefNum().mIndex == refNum && ref->mRef.getMpNum() == mpNum &&
+                isAccessible(ref->mData, ref->mRef))
+            {
+                mHasState = true;
+                return Ptr(ref, this);
+            }
+        }
+
+        // The index can miss refs whose numbers were assigned after they were placed, as well as
+        // deleted refs sharing their numbers with newer ones, so fall back to going through the cell
+        // and remember what was found
         SearchExactVisitor<MWWorld::Ptr> searchVisitor;
         searchVisitor.mRefNumToFind = refNum;
         searchVisitor.mMpNumToFind = mpNum;
         forEach(searchVisitor);
+
+        if (!searchVisitor.mFound.isEmpty())
+            mRefNumIndex[key] = searchVisitor.mFound.getBase();
+
         return searchVisitor.mFound;
     }
     /*
         End of tes3mp addition
     */
 
+    /*
+        Start of tes3mp addition
+
+        Index the refs in mMergedRefs by their refNum and mpNum, so searchExact() doesn't need
+        to go through the entire cell
+    */
+    uint64_t CellStore::getRefNumIndexKey(unsigned int refNum, unsigned int mpNum)
+    {
+        return (static_cast<uint64_t>(refNum) << 32) | mpNum;
+    }
+
+    void CellStore::updateRefNumIndex()
+    {
+        mRefNumIndex.clear();
+        mRefNumIndex.reserve(mMergedRefs.size());
+
+        for (LiveCellRefBase *ref : mMergedRefs)
+        {
+            unsigned int refNum = ref->mRef.getRefNum().mIndex;
+            unsigned int mpNum = ref->mRef.getMpNum();
+
+            if (refNum == 0 && mpNum == 0)
+                continue;
+
+            // Like a search through the cell, prefer the first accessible ref with these numbers
+            auto result = mRefNumIndex.emplace(getRefNumIndexKey(refNum, mpNum), ref);
+
+            if (!result.second && !isAccessible(result.first->second->mData, result.first->second->mRef) &&
+                isAccessible(ref->mData, ref->mRef))
+                result.first->second = ref;
+        }
+    }
+    /*
+        End of tes3mp addition
+    */
+
     /*
         Start of tes3mp addition
 
@@ -7,6 +7,7 @@
 #include <typeinfo>
 #include <map>
 #include <memory>
+#include <unordered_map>
 
 #include "livecellref.hpp"
 #include "cellreflist.hpp"
@@ -109,6 +110,20 @@ namespace MWWorld
             // Merged list of ref's currently in this cell - i.e. with added refs from mMovedHere, removed refs from mMovedToAnotherCell
             std::vector<LiveCellRefBase*> mMergedRefs;
 
+            /*
+                Start of tes3mp addition
+
+                Index the refs in mMergedRefs by their refNum and mpNum, so searchExact() doesn't need
+                to go through the entire cell
+            */
+            std::unordered_map<uint64_t, LiveCellRefBase*> mRefNumIndex;
+
+            static uint64_t getRefNumIndexKey(unsigned int refNum, unsigned int mpNum);
+            void updateRefNumIndex();
+            /*
+                End of tes3mp addition
+            */
+
             // Get the Ptr for the given ref which originated from this cell (possibly moved to another cell at this point).
             Ptr getCurrentPtr(MWWorld::LiveCellRefBase* ref);
 
@@ -21,6 +21,12 @@ struct ContentLoader
     {
     }
 
+    /// Called for every content file, in load order, before any of them is loaded,
+    /// so the loader can start reading them ahead of time.
+    virtual void prepare(const boost::filesystem::path& filepath, int index)
+    {
+    }
+
     virtual void load(const boost::filesystem::path& filepath, int& index)
     {
         Log(Debug::Info) << "Loading content file " << filepath.string();
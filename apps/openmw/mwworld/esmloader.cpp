@@ -1,7 +1,11 @@
 #include "esmloader.hpp"
-#include "esmstore.hpp"
 
+#include <algorithm>
+
+#include <components/debug/debuglog.hpp>
 #include <components/esm/esmreader.hpp>
+#include <components/settings/settings.hpp>
+#include <components/to_utf8/to_utf8.hpp>
 
 namespace MWWorld
 {
@@ -12,20 +16,128 @@ EsmLoader::EsmLoader(MWWorld::ESMStore& store, std::vector<ESM::ESMReader>& read
   , mEsm(readers)
   , mStore(store)
   , mEncoder(encoder)
+  , mNextDecode(0)
+  , mNextLoad(0)
+  , mMaxAhead(0)
+  , mStopping(false)
+{
+}
+
+EsmLoader::~EsmLoader()
 {
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStopping = true;
+  }
+  mCondition.notify_all();
+
+  for (std::thread& decoder : mDecoders)
+    decoder.join();
+}
+
+void EsmLoader::prepare(const boost::filesystem::path& filepath, int index)
+{
+  // Records that were read from the content cache aren't decoded again, which leaves little to do ahead of time
+  if (!mDecoders.empty() || mStore.isLoadedFromCache() || !Settings::Manager::getBool("parallel content loading", "General"))
+    return;
+
+  mPendingByIndex[index] = mPending.size();
+  mPending.push_back(PendingFile());
+  mPending.back().mPath = filepath;
+  mPending.back().mIndex = index;
 }
 
 void EsmLoader::load(const boost::filesystem::path& filepath, int& index)
 {
   ContentLoader::load(filepath.filename(), index);
 
+  if (mDecoders.empty() && !mPending.empty())
+    startDecoding();
+
   ESM::ESMReader lEsm;
   lEsm.setEncoder(mEncoder);
   lEsm.setIndex(index);
   lEsm.setGlobalReaderList(&mEsm);
   lEsm.open(filepath.string());
   mEsm[index] = lEsm;
-  mStore.load(mEsm[index], &mListener);
+
+  ESMStore::StagedContent staged;
+  if (takeStaged(index, staged))
+    mStore.load(mEsm[index], &mListener, &staged);
+  else
+    mStore.load(mEsm[index], &mListener);
+}
+
+void EsmLoader::startDecoding()
+{
+  // Leave a core for the main thread, which adds the decoded records to the store
+  unsigned int threads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+  threads = std::min(threads, static_cast<unsigned int>(mPending.size()));
+
+  // Don't let the decoders get too far ahead, since every decoded file is kept in memory until it's loaded
+  mMaxAhead = threads * 2;
+
+  Log(Debug::Info) << "Decoding " << mPending.size() << " content files on " << threads << " threads";
+
+  for (unsigned int i = 0; i < threads; ++i)
+    mDecoders.emplace_back(&EsmLoader::runDecoder, this);
+}
+
+void EsmLoader::runDecoder()
+{
+  // The encoder keeps a conversion buffer, so every thread needs its own
+  std::unique_ptr<ToUTF8::Utf8Encoder> encoder;
+  if (mEncoder)
+    encoder.reset(new ToUTF8::Utf8Encoder(*mEncoder));
+
+  while (true)
+  {
+    size_t next;
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mCondition.wait(lock, [this] () {
+        return mStopping || mNextDecode >= mPending.size() || mNextDecode < mNextLoad + mMaxAhead;
+      });
+
+      if (mStopping || mNextDecode >= mPending.size())
+        return;
+
+      next = mNextDecode++;
+    }
+
+    PendingFile& file = mPending[next];
+    try
+    {
+      ESM::ESMReader reader;
+      reader.setEncoder(encoder.get());
+      reader.setIndex(file.mIndex);
+      reader.open(file.mPath.string());
+
+      ESMStore::StagedContent staged;
+      mStore.decode(reader, staged);
+      file.mPromise.set_value(std::move(staged));
+    }
+    catch (...)
+    {
+      file.mPromise.set_exception(std::current_exception());
+    }
+  }
+}
+
+bool EsmLoader::takeStaged(int index, ESMStore::StagedContent& staged)
+{
+  std::map<int, size_t>::const_iterator found = mPendingByIndex.find(index);
+  if (found == mPendingByIndex.end())
+    return false;
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mNextLoad = found->second + 1;
+  }
+  mCondition.notify_all();
+
+  staged = mPending[found->second].mPromise.get_future().get();
+  return true;
 }
 
 } /* namespace MWWorld */
@@ -1,9 +1,15 @@
 #ifndef ESMLOADER_HPP
 #define ESMLOADER_HPP
 
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "contentloader.hpp"
+#include "esmstore.hpp"
 
 namespace ToUTF8
 {
@@ -18,19 +24,46 @@ namespace ESM
 namespace MWWorld
 {
 
-class ESMStore;
-
+/// Loads content files into the ESMStore in load order, while a few threads decode the
+/// records of the files that come next ahead of time, when parallel content loading is enabled.
 struct EsmLoader : public ContentLoader
 {
     EsmLoader(MWWorld::ESMStore& store, std::vector<ESM::ESMReader>& readers,
       ToUTF8::Utf8Encoder* encoder, Loading::Listener& listener);
+    ~EsmLoader();
 
+    void prepare(const boost::filesystem::path& filepath, int index);
     void load(const boost::filesystem::path& filepath, int& index);
 
     private:
+      struct PendingFile
+      {
+          boost::filesystem::path mPath;
+          int mIndex;
+          std::promise<ESMStore::StagedContent> mPromise;
+      };
+
+      void startDecoding();
+      void runDecoder();
+
+      // Wait for the records of the file with this index to be decoded, returning false if it was never prepared
+      bool takeStaged(int index, ESMStore::StagedContent& staged);
+
       std::vector<ESM::ESMReader>& mEsm;
       MWWorld::ESMStore& mStore;
       ToUTF8::Utf8Encoder* mEncoder;
+
+      // Neither of these change once the decoders have started
+      std::vector<PendingFile> mPending;
+      std::map<int, size_t> mPendingByIndex;
+
+      std::vector<std::thread> mDecoders;
+      std::mutex mMutex;
+      std::condition_variable mCondition;
+      size_t mNextDecode;
+      size_t mNextLoad;
+      size_t mMaxAhead;
+      bool mStopping;
 };
 
 } /* namespace MWWorld */
@@ -26,7 +26,27 @@ static bool isCacheableRecord(int id)
     return false;
 }
 
-void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
+void ESMStore::decode(ESM::ESMReader &esm, StagedContent &staged) const
+{
+    while(esm.hasMoreRecs())
+    {
+        ESM::NAME n = esm.getRecName();
+        esm.getRecHeader();
+
+        std::unique_ptr<StagedRecord> record;
+
+        std::map<int, StoreBase *>::const_iterator it = mStores.find(n.intval);
+        if (it != mStores.end())
+            record = it->second->decode(esm);
+
+        if (!record)
+            esm.skipRecord();
+
+        staged.push_back(std::move(record));
+    }
+}
+
+void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener, StagedContent* staged)
 {
     listener->setProgressRange(1000);
 
@@ -67,11 +87,17 @@ void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
     }
 
     // Loop through all records
+    size_t recordIndex = 0;
     while(esm.hasMoreRecs())
     {
         ESM::NAME n = esm.getRecName();
         esm.getRecHeader();
 
+        std::unique_ptr<StagedRecord> stagedRecord;
+        if (staged && recordIndex < staged->size())
+            stagedRecord = std::move((*staged)[recordIndex]);
+        ++recordIndex;
+
         // Look up the record type.
         std::map<int, StoreBase *>::iterator it = mStores.find(n.intval);
 
@@ -101,8 +127,20 @@ void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
                 error << "Unknown record: " << n.toString();
                 throw std::runtime_error(error.str());
             }
+        } else if (mLoadedFromCache && it->second->isIndependent()) {
+            // Already read from the content cache
+            esm.skipRecord();
+            dialogue = 0;
         } else {
-            RecordId id = it->second->load(esm);
+            RecordId id;
+            if (stagedRecord)
+            {
+                esm.skipRecord();
+                id = it->second->loadStaged(*stagedRecord);
+            }
+            else
+                id = it->second->load(esm);
+
             if (id.mIsDeleted)
             {
                 it->second->eraseStatic(id.mId);
@@ -119,6 +157,41 @@ void ESMStore::load(ESM::ESMReader &esm, Loading::Listener* listener)
     }
 }
 
+void ESMStore::writeCache(ESM::ESMWriter &writer) const
+{
+    for (std::map<int, StoreBase *>::const_iterator it = mStores.begin(); it != mStores.end(); ++it)
+    {
+        if (it->second->isIndependent())
+            it->second->writeCache(writer);
+    }
+}
+
+void ESMStore::loadCache(ESM::ESMReader &esm)
+{
+    // Decode everything before adding anything, so a cache that turns out to be unreadable leaves the stores untouched
+    std::vector<std::pair<StoreBase *, std::unique_ptr<StagedRecord> > > records;
+    while(esm.hasMoreRecs())
+    {
+        ESM::NAME n = esm.getRecName();
+        esm.getRecHeader();
+
+        std::map<int, StoreBase *>::iterator it = mStores.find(n.intval);
+        if (it == mStores.end() || !it->second->isIndependent())
+            esm.fail("Unexpected record in content cache: " + n.toString());
+
+        std::unique_ptr<StagedRecord> record = it->second->decode(esm);
+        if (!record)
+            esm.fail("Unexpected record in content cache: " + n.toString());
+
+        records.emplace_back(it->second, std::move(record));
+    }
+
+    for (auto& record : records)
+        record.first->loadStaged(*record.second);
+
+    mLoadedFromCache = true;
+}
+
 void ESMStore::setUp(bool validateRecords)
 {
     mIds.clear();
@@ -74,6 +74,8 @@ namespace MWWorld
 
         unsigned int mDynamicCount;
 
+        bool mLoadedFromCache;
+
         /// Validate entries in store after setup
         void validate();
 
@@ -102,6 +104,7 @@ namespace MWWorld
 
         ESMStore()
           : mDynamicCount(0)
+          , mLoadedFromCache(false)
         {
             mStores[ESM::REC_ACTI] = &mActivators;
             mStores[ESM::REC_ALCH] = &mPotions;
@@ -161,7 +164,29 @@ namespace MWWorld
             mNpcs.insert(mPlayerTemplate);
         }
 
-        void load(ESM::ESMReader &esm, Loading::Listener* listener);
+        /// Records of one content file decoded ahead of time, in the order they appear in the file.
+        /// Records that can only be loaded in order are left empty.
+        typedef std::vector<std::unique_ptr<StagedRecord> > StagedContent;
+
+        /// Decode every record of a content file that doesn't depend on the records loaded before it.
+        /// @note Doesn't touch the stores, so it may be called from other threads while load() runs.
+        void decode(ESM::ESMReader &esm, StagedContent &staged) const;
+
+        /// Load a content file, taking its records from \a staged wherever they were decoded ahead of time.
+        void load(ESM::ESMReader &esm, Loading::Listener* listener, StagedContent* staged = nullptr);
+
+        /// Write the records of every store whose records don't depend on the load order to the content cache.
+        /// @note Call once setUp() has validated the records, so they don't need validating when read back.
+        void writeCache(ESM::ESMWriter &writer) const;
+
+        /// Read the records written by writeCache(), either all of them or none if the cache can't be read.
+        /// From then on load() skips the records of these stores, since the cache holds the result of loading them.
+        void loadCache(ESM::ESMReader &esm);
+
+        bool isLoadedFromCache() const
+        {
+            return mLoadedFromCache;
+        }
 
         template <class T>
         const Store<T> &get() const {
@@ -0,0 +1,164 @@
+#include "esmstorecache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include <boost/crc.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include <components/debug/debuglog.hpp>
+#include <components/esm/esmreader.hpp>
+#include <components/esm/esmwriter.hpp>
+#include <components/files/mappedfile.hpp>
+
+#include "esmstore.hpp"
+
+namespace
+{
+    const char sMagic[] = "OMWSTORE";
+
+    // Increase whenever the cached records would be saved or loaded differently
+    const uint32_t sVersion = 2;
+
+    // The header is the magic, version and key size, followed by the key, the checksum and the size of the body
+    const size_t sKeyOffset = 8 + 4 + 4;
+    const size_t sFixedHeaderSize = sKeyOffset + 4 + 8;
+
+    void writeInt(std::string& buffer, uint64_t value, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+            buffer += static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+
+    uint64_t readInt(const char* data, size_t size)
+    {
+        uint64_t value = 0;
+        for (size_t i = 0; i < size; ++i)
+            value |= static_cast<uint64_t>(static_cast<unsigned char>(data[i])) << (i * 8);
+        return value;
+    }
+
+    uint32_t getChecksum(const char* data, size_t size)
+    {
+        boost::crc_32_type crc;
+        crc.process_bytes(data, size);
+        return crc.checksum();
+    }
+}
+
+namespace MWWorld
+{
+    ESMStoreCache::ESMStoreCache(const boost::filesystem::path& cacheFile, const std::vector<boost::filesystem::path>& contentFiles,
+                                 ToUTF8::FromType encoding)
+        : mPath(cacheFile)
+    {
+        // Names and texts are cached after being converted to UTF-8, so they're only valid for the same encoding
+        std::ostringstream key;
+        key << static_cast<int>(encoding) << '\n';
+        for (const boost::filesystem::path& file : contentFiles)
+        {
+            boost::system::error_code ec;
+            uintmax_t size = boost::filesystem::file_size(file, ec);
+            std::time_t time = boost::filesystem::last_write_time(file, ec);
+            key << file.string() << '\0' << size << '\0' << time << '\n';
+        }
+        mKey = key.str();
+    }
+
+    bool ESMStoreCache::load(ESMStore& store) const
+    {
+        if (!boost::filesystem::exists(mPath))
+            return false;
+
+        try
+        {
+            Files::MappedFilePtr file = std::make_shared<Files::MappedFile>(mPath.string());
+            const char* data = file->data();
+            const size_t size = file->size();
+
+            if (size < sFixedHeaderSize || std::memcmp(data, sMagic, 8) != 0 || readInt(data + 8, 4) != sVersion)
+            {
+                Log(Debug::Info) << "Content cache " << mPath.string() << " was written by another version, ignoring it";
+                return false;
+            }
+
+            const size_t keySize = readInt(data + 12, 4);
+            const size_t bodyStart = sFixedHeaderSize + keySize;
+            if (bodyStart > size || mKey.compare(0, std::string::npos, data + sKeyOffset, keySize) != 0)
+            {
+                Log(Debug::Info) << "Content files have changed since the content cache was written, loading them in full";
+                return false;
+            }
+
+            const uint32_t checksum = static_cast<uint32_t>(readInt(data + sKeyOffset + keySize, 4));
+            const uint64_t bodySize = readInt(data + sKeyOffset + keySize + 4, 8);
+            if (bodySize != size - bodyStart || getChecksum(data + bodyStart, bodySize) != checksum)
+            {
+                Log(Debug::Warning) << "Content cache " << mPath.string() << " is damaged, loading the content files in full";
+                return false;
+            }
+
+            ESM::ESMReader reader;
+            reader.open(Files::MappedFile::openStream(file, bodyStart, bodySize), mPath.string());
+            store.loadCache(reader);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to read content cache " << mPath.string() << ": " << e.what();
+            return false;
+        }
+
+        Log(Debug::Info) << "Loaded records from content cache " << mPath.string();
+        return true;
+    }
+
+    void ESMStoreCache::save(const ESMStore& store) const
+    {
+        try
+        {
+            // Strings are cached as they are, already converted to UTF-8, which is why the key includes the encoding
+            std::ostringstream body;
+            ESM::ESMWriter writer;
+            writer.setVersion();
+            writer.setType(0);
+            writer.setFormat(0);
+            writer.setAuthor("");
+            writer.setDescription("");
+            writer.setRecordCount(0);
+            writer.save(body);
+            store.writeCache(writer);
+            writer.close();
+
+            const std::string bodyData = body.str();
+
+            std::string header(sMagic, 8);
+            writeInt(header, sVersion, 4);
+            writeInt(header, mKey.size(), 4);
+            header += mKey;
+            writeInt(header, getChecksum(bodyData.data(), bodyData.size()), 4);
+            writeInt(header, bodyData.size(), 8);
+
+            // Write to a temporary file first, so an interrupted write never leaves a cache that looks complete
+            const std::string temporaryPath = mPath.string() + ".tmp";
+            {
+                std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+                stream.write(header.data(), header.size());
+                stream.write(bodyData.data(), bodyData.size());
+                if (!stream)
+                    throw std::runtime_error("Could not write " + temporaryPath);
+            }
+
+            // Replaces the old cache in one step, so it is never missing if we are interrupted here
+            boost::filesystem::rename(temporaryPath, mPath);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Failed to write content cache " << mPath.string() << ": " << e.what();
+            return;
+        }
+
+        Log(Debug::Info) << "Wrote content cache " << mPath.string();
+    }
+}
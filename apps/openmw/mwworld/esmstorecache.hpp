@@ -0,0 +1,41 @@
+#ifndef GAME_MWWORLD_ESMSTORECACHE_H
+#define GAME_MWWORLD_ESMSTORECACHE_H
+
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+#include <components/to_utf8/to_utf8.hpp>
+
+namespace MWWorld
+{
+    class ESMStore;
+
+    /// @brief Keeps the records of the ESMStore that don't depend on the order they were loaded in, once every
+    /// content file has been merged and validated, so the next start with the same content files can read them
+    /// from a single file instead of parsing every content file.
+    /// @par The cache is only used if it was written for the same content files in the same order, with the same
+    /// sizes and modification times, for the same encoding, and its checksum matches. Otherwise the content files are loaded in full and
+    /// the cache is written again afterwards.
+    class ESMStoreCache
+    {
+    public:
+        ESMStoreCache(const boost::filesystem::path& cacheFile, const std::vector<boost::filesystem::path>& contentFiles,
+                      ToUTF8::FromType encoding);
+
+        /// Read the cached records into the store, returning false if there is no usable cache.
+        bool load(ESMStore& store) const;
+
+        /// Write the records of a store that has been loaded from the content files and set up.
+        void save(const ESMStore& store) const;
+
+    private:
+        boost::filesystem::path mPath;
+
+        // Identifies the content files and the encoding the cache was written for
+        std::string mKey;
+    };
+}
+
+#endif
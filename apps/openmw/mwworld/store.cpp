@@ -30,6 +30,30 @@ namespace
         }
     };
 
+    template<typename T>
+    struct Staged : public MWWorld::StagedRecord
+    {
+        T mRecord;
+        bool mIsDeleted = false;
+    };
+
+    template<typename T>
+    uint32_t getRecordFlags(const T&)
+    {
+        return 0;
+    }
+
+    // Creatures and NPCs read whether they are persistent from the flags in their record header
+    uint32_t getRecordFlags(const ESM::Creature& record)
+    {
+        return record.mPersistent ? 0x0400 : 0;
+    }
+
+    uint32_t getRecordFlags(const ESM::NPC& record)
+    {
+        return record.mPersistent ? 0x0400 : 0;
+    }
+
     struct Compare
     {
         bool operator()(const ESM::Land *x, const ESM::Land *y) {
@@ -191,11 +215,23 @@ namespace MWWorld
     template<typename T>
     RecordId Store<T>::load(ESM::ESMReader &esm)
     {
-        T record;
-        bool isDeleted = false;
+        std::unique_ptr<StagedRecord> record = decode(esm);
+        return loadStaged(*record);
+    }
+    template<typename T>
+    std::unique_ptr<StagedRecord> Store<T>::decode(ESM::ESMReader &esm) const
+    {
+        Staged<T>* staged = new Staged<T>;
+        std::unique_ptr<StagedRecord> result(staged);
 
-        record.load(esm, isDeleted);
-        Misc::StringUtils::lowerCaseInPlace(record.mId);
+        staged->mRecord.load(esm, staged->mIsDeleted);
+        Misc::StringUtils::lowerCaseInPlace(staged->mRecord.mId);
+        return result;
+    }
+    template<typename T>
+    RecordId Store<T>::loadStaged(StagedRecord &staged)
+    {
+        const T& record = static_cast<Staged<T>&>(staged).mRecord;
 
         std::pair<typename Static::iterator, bool> inserted = mStatic.insert(std::make_pair(record.mId, record));
         if (inserted.second)
@@ -203,7 +239,23 @@ namespace MWWorld
         else
             inserted.first->second = record;
 
-        return RecordId(record.mId, isDeleted);
+        return RecordId(record.mId, static_cast<Staged<T>&>(staged).mIsDeleted);
+    }
+    template<typename T>
+    bool Store<T>::isIndependent() const
+    {
+        return true;
+    }
+    template<typename T>
+    void Store<T>::writeCache(ESM::ESMWriter& writer) const
+    {
+        // The static records come first in mShared, in the order they were added
+        for (size_t i = 0; i < mStatic.size(); ++i)
+        {
+            writer.startRecord (T::sRecordId, getRecordFlags(*mShared[i]));
+            mShared[i]->save (writer);
+            writer.endRecord (T::sRecordId);
+        }
     }
     template<typename T>
     void Store<T>::setUp()
@@ -1127,6 +1179,19 @@ namespace MWWorld
         return RecordId(dialogue.mId, isDeleted);
     }
 
+    template <>
+    std::unique_ptr<StagedRecord> Store<ESM::Dialogue>::decode(ESM::ESMReader &esm) const
+    {
+        // Dialogues merge into the ones loaded before them, and the INFO records after them are added to them
+        return nullptr;
+    }
+
+    template <>
+    bool Store<ESM::Dialogue>::isIndependent() const
+    {
+        return false;
+    }
+
     template<>
     bool Store<ESM::Dialogue>::eraseStatic(const std::string &id)
     {
@@ -1,6 +1,7 @@
 #ifndef OPENMW_MWWORLD_STORE_H
 #define OPENMW_MWWORLD_STORE_H
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <map>
@@ -27,6 +28,13 @@ namespace MWWorld
         RecordId(const std::string &id = "", bool isDeleted = false);
     };
 
+    /// A record decoded by StoreBase::decode, waiting to be added to its store by StoreBase::loadStaged.
+    class StagedRecord
+    {
+    public:
+        virtual ~StagedRecord() {}
+    };
+
     class StoreBase
     {
     public:
@@ -41,6 +49,21 @@ namespace MWWorld
         virtual int getDynamicSize() const { return 0; }
         virtual RecordId load(ESM::ESMReader &esm) = 0;
 
+        /// Decode the next record without adding it to this store, or return nullptr without reading anything
+        /// if the records of this store depend on the ones loaded before them and can only be loaded by load().
+        /// @note Does not touch the store, so it may be called from another thread while the store is loading.
+        virtual std::unique_ptr<StagedRecord> decode(ESM::ESMReader &esm) const { return nullptr; }
+
+        /// Add a record returned by decode(), the same way load() would have added it.
+        virtual RecordId loadStaged(StagedRecord &record) { return RecordId(); }
+
+        /// Are the records of this store added the same way whatever was loaded before them?
+        /// Only those are kept in the content cache.
+        virtual bool isIndependent() const { return false; }
+
+        /// Write the records loaded from the content files to the content cache, in the order they were added.
+        virtual void writeCache(ESM::ESMWriter& writer) const {}
+
         virtual bool eraseStatic(const std::string &id) {return false;}
         virtual void clearDynamic() {}
 
@@ -192,6 +215,10 @@ namespace MWWorld
         bool erase(const T &item);
 
         RecordId load(ESM::ESMReader &esm);
+        std::unique_ptr<StagedRecord> decode(ESM::ESMReader &esm) const;
+        RecordId loadStaged(StagedRecord &record);
+        bool isIndependent() const;
+        void writeCache(ESM::ESMWriter& writer) const;
         void write(ESM::ESMWriter& writer, Loading::Listener& progress) const;
         RecordId read(ESM::ESMReader& reader);
     };
@@ -88,6 +88,7 @@
 
 #include "contentloader.hpp"
 #include "esmloader.hpp"
+#include "esmstorecache.hpp"
 
 namespace
 {
@@ -118,6 +119,13 @@ namespace MWWorld
             return mLoaders.insert(std::make_pair(extension, loader)).second;
         }
 
+        void prepare(const boost::filesystem::path& filepath, int index)
+        {
+            LoadersContainer::iterator it(mLoaders.find(Misc::StringUtils::lowerCase(filepath.extension().string())));
+            if (it != mLoaders.end())
+                it->second->prepare(filepath, index);
+        }
+
         void load(const boost::filesystem::path& filepath, int& index)
         {
             LoadersContainer::iterator it(mLoaders.find(Misc::StringUtils::lowerCase(filepath.extension().string())));
@@ -177,7 +185,7 @@ namespace MWWorld
         Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
         const Files::Collections& fileCollections,
         const std::vector<std::string>& contentFiles,
-        ToUTF8::Utf8Encoder* encoder, int activationDistanceOverride,
+        ToUTF8::Utf8Encoder* encoder, ToUTF8::FromType encoding, int activationDistanceOverride,
         const std::string& startCell, const std::string& startupScript,
         const std::string& resourcePath, const std::string& userDataPath)
     : mResourceSystem(resourceSystem), mLocalScripts (mStore),
@@ -195,13 +203,22 @@ namespace MWWorld
         GameContentLoader gameContentLoader(*listener);
         EsmLoader esmLoader(mStore, mEsm, encoder, *listener);
 
+        std::vector<boost::filesystem::path> contentPaths = resolveContentFiles(fileCollections, contentFiles);
+
+        // Read the records that don't depend on the load order from the content cache if it's up to date,
+        // in which case loading the content files only adds the remaining records
+        const bool useContentCache = Settings::Manager::getBool("content cache", "General");
+        ESMStoreCache contentCache(boost::filesystem::path(userDataPath) / "content.cache", contentPaths, encoding);
+        if (useContentCache)
+            contentCache.load(mStore);
+
         gameContentLoader.addLoader(".esm", &esmLoader);
         gameContentLoader.addLoader(".esp", &esmLoader);
         gameContentLoader.addLoader(".omwgame", &esmLoader);
         gameContentLoader.addLoader(".omwaddon", &esmLoader);
         gameContentLoader.addLoader(".project", &esmLoader);
 
-        loadContentFiles(fileCollections, contentFiles, gameContentLoader);
+        loadContentFiles(contentPaths, gameContentLoader);
 
         listener->loadingOff();
 
@@ -211,7 +228,12 @@ namespace MWWorld
 
         fillGlobalVariables();
 
-        mStore.setUp(true);
+        // Records read from the content cache were validated before they were cached
+        mStore.setUp(!mStore.isLoadedFromCache());
+
+        if (useContentCache && !mStore.isLoadedFromCache())
+            contentCache.save(mStore);
+
         mStore.movePlayerRecord();
 
         mSwimHeightScale = mStore.get<ESM::GameSetting>().find("fSwimHeightScale")->mValue.getFloat();
@@ -3359,23 +3381,37 @@ namespace MWWorld
         return mScriptsEnabled;
     }
 
-    void World::loadContentFiles(const Files::Collections& fileCollections,
-        const std::vector<std::string>& content, ContentLoader& contentLoader)
+    std::vector<boost::filesystem::path> World::resolveContentFiles(const Files::Collections& fileCollections,
+        const std::vector<std::string>& content)
     {
-        int idx = 0;
+        std::vector<boost::filesystem::path> paths;
         for (const std::string &file : content)
         {
             boost::filesystem::path filename(file);
             const Files::MultiDirCollection& col = fileCollections.getCollection(filename.extension().string());
             if (col.doesExist(file))
             {
-                contentLoader.load(col.getPath(file), idx);
+                paths.push_back(col.getPath(file));
             }
             else
             {
                 std::string message = "Failed loading " + file + ": the content file does not exist";
                 throw std::runtime_error(message);
             }
+        }
+
+        return paths;
+    }
+
+    void World::loadContentFiles(const std::vector<boost::filesystem::path>& paths, ContentLoader& contentLoader)
+    {
+        for (size_t i = 0; i < paths.size(); ++i)
+            contentLoader.prepare(paths[i], static_cast<int>(i));
+
+        int idx = 0;
+        for (const boost::filesystem::path &path : paths)
+        {
+            contentLoader.load(path, idx);
             idx++;
         }
     }
@@ -5,6 +5,7 @@
 
 #include <components/settings/settings.hpp>
 #include <components/fallback/fallback.hpp>
+#include <components/to_utf8/to_utf8.hpp>
 
 #include "../mwbase/world.hpp"
 
@@ -54,11 +55,6 @@ namespace MWRender
     class Camera;
 }
 
-namespace ToUTF8
-{
-    class Utf8Encoder;
-}
-
 struct ContentLoader;
 
 namespace MWPhysics
@@ -172,13 +168,20 @@ namespace MWWorld
             void fillGlobalVariables();
 
             /**
-             * @brief loadContentFiles - Loads content files (esm,esp,omwgame,omwaddon)
+             * @brief resolveContentFiles - Finds the paths of content files (esm,esp,omwgame,omwaddon)
              * @param fileCollections- Container which holds content file names and their paths
              * @param content - Container which holds content file names
+             * @return The path of every content file, in load order
+             */
+            std::vector<boost::filesystem::path> resolveContentFiles(const Files::Collections& fileCollections,
+                const std::vector<std::string>& content);
+
+            /**
+             * @brief loadContentFiles - Loads content files (esm,esp,omwgame,omwaddon)
+             * @param paths - The paths of the content files, in load order
              * @param contentLoader -
              */
-            void loadContentFiles(const Files::Collections& fileCollections,
-                const std::vector<std::string>& content, ContentLoader& contentLoader);
+            void loadContentFiles(const std::vector<boost::filesystem::path>& paths, ContentLoader& contentLoader);
 
             float mSwimHeightScale;
 
@@ -207,7 +210,7 @@ namespace MWWorld
                 Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
                 const Files::Collections& fileCollections,
                 const std::vector<std::string>& contentFiles,
-                ToUTF8::Utf8Encoder* encoder, int activationDistanceOverride,
+                ToUTF8::Utf8Encoder* encoder, ToUTF8::FromType encoding, int activationDistanceOverride,
                 const std::string& startCell, const std::string& startupScript,
                 const std::string& resourcePath, const std::string& userDataPath);
 
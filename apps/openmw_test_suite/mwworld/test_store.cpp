@@ -8,6 +8,7 @@
 #include <components/loadinglistener/loadinglistener.hpp>
 
 #include "apps/openmw/mwworld/esmstore.hpp"
+#include "apps/openmw/mwworld/esmstorecache.hpp"
 
 static Loading::Listener dummyListener;
 
@@ -313,3 +314,239 @@ TEST_F(StoreTest, overwrite_test)
 
     ASSERT_TRUE (overwrittenRec && overwrittenRec->mModel == "the_new_model");
 }
+
+/// Write a record to an in-memory ESM file.
+/// @param flags Flags of the record header
+template <typename T>
+void writeRecord(ESM::ESMWriter& writer, const T& record, bool deleted, uint32_t flags = 0)
+{
+    writer.startRecord(T::sRecordId, flags);
+    record.save(writer, deleted);
+    writer.endRecord(T::sRecordId);
+}
+
+/// Load an in-memory ESM file into the store.
+void loadEsmFile(MWWorld::ESMStore& esmStore, const std::string& data)
+{
+    ESM::ESMReader reader;
+    std::vector<ESM::ESMReader> readerList;
+    readerList.push_back(reader);
+    reader.setGlobalReaderList(&readerList);
+
+    reader.open(Files::IStreamPtr(new std::stringstream(data)), "filename");
+    esmStore.load(reader, &dummyListener);
+}
+
+/// Base class for tests of the content cache, with a store loaded from a file that has records of several types
+struct ContentCacheTest : public StoreTest
+{
+protected:
+    virtual void SetUp()
+    {
+        std::stringstream stream;
+        ESM::ESMWriter writer;
+        writer.setFormat(0);
+        writer.save(stream);
+
+        // Written out of alphabetical order, to check that the cache keeps the order of the content files
+        ESM::Apparatus apparatus;
+        apparatus.blank();
+        apparatus.mId = "retort";
+        apparatus.mName = "Cornue \xc3\xa0 l'alambic"; // UTF-8, which the cache has to keep as it is
+        writeRecord(writer, apparatus, false);
+
+        apparatus.mId = "calcinator";
+        apparatus.mName = "Calcinator";
+        writeRecord(writer, apparatus, false);
+
+        ESM::NPC npc;
+        npc.blank();
+        npc.mId = "guard";
+        npc.mPersistent = true;
+        writeRecord(writer, npc, false, 0x0400);
+
+        npc.mId = "commoner";
+        npc.mPersistent = false;
+        writeRecord(writer, npc, false);
+
+        mEsmData = stream.str();
+        loadEsmFile(mEsmStore, mEsmData);
+        mEsmStore.setUp();
+
+        mContentFiles.push_back("Morrowind.esm");
+        mContentFiles.push_back("Tribunal.esm");
+        mCachePath = "test_content_cache.cache";
+    }
+
+    virtual void TearDown()
+    {
+        boost::filesystem::remove(mCachePath);
+    }
+
+    std::string mEsmData;
+    std::vector<boost::filesystem::path> mContentFiles;
+    boost::filesystem::path mCachePath;
+};
+
+/// Tests that the records read back from the content cache are the ones that were written, in the same order.
+TEST_F(ContentCacheTest, round_trip_test)
+{
+    MWWorld::ESMStoreCache(mCachePath, mContentFiles, ToUTF8::WINDOWS_1252).save(mEsmStore);
+
+    MWWorld::ESMStore cachedStore;
+    ASSERT_TRUE (MWWorld::ESMStoreCache(mCachePath, mContentFiles, ToUTF8::WINDOWS_1252).load(cachedStore));
+    cachedStore.setUp();
+
+    EXPECT_TRUE (cachedStore.isLoadedFromCache());
+
+    const MWWorld::Store<ESM::Apparatus>& apparatus = mEsmStore.get<ESM::Apparatus>();
+    const MWWorld::Store<ESM::Apparatus>& cachedApparatus = cachedStore.get<ESM::Apparatus>();
+    ASSERT_EQ (apparatus.getSize(), cachedApparatus.getSize());
+    for (MWWorld::Store<ESM::Apparatus>::iterator it = apparatus.begin(), cachedIt = cachedApparatus.begin();
+         it != apparatus.end(); ++it, ++cachedIt)
+    {
+        EXPECT_EQ (it->mId, cachedIt->mId);
+        EXPECT_EQ (it->mName, cachedIt->mName);
+    }
+    EXPECT_EQ ("retort", cachedApparatus.begin()->mId);
+    EXPECT_EQ ("Cornue \xc3\xa0 l'alambic", cachedApparatus.find("retort")->mName);
+
+    const MWWorld::Store<ESM::NPC>& npcs = mEsmStore.get<ESM::NPC>();
+    const MWWorld::Store<ESM::NPC>& cachedNpcs = cachedStore.get<ESM::NPC>();
+    ASSERT_EQ (npcs.getSize(), cachedNpcs.getSize());
+    for (MWWorld::Store<ESM::NPC>::iterator it = npcs.begin(), cachedIt = cachedNpcs.begin();
+         it != npcs.end(); ++it, ++cachedIt)
+    {
+        EXPECT_EQ (it->mId, cachedIt->mId);
+        EXPECT_EQ (it->mPersistent, cachedIt->mPersistent);
+    }
+    EXPECT_TRUE (cachedNpcs.find("guard")->mPersistent);
+    EXPECT_FALSE (cachedNpcs.find("commoner")->mPersistent);
+}
+
+/// Tests that a cache written for other content files or another encoding is not used.
+TEST_F(ContentCacheTest, changed_key_test)
+{
+    MWWorld::ESMStoreCache(mCachePath, mContentFiles, ToUTF8::WINDOWS_1252).save(mEsmStore);
+
+    MWWorld::ESMStore otherEncodingStore;
+    EXPECT_FALSE (MWWorld::ESMStoreCache(mCachePath, mContentFiles, ToUTF8::WINDOWS_1251).load(otherEncodingStore));
+    EXPECT_FALSE (otherEncodingStore.isLoadedFromCache());
+    EXPECT_EQ (0u, otherEncodingStore.get<ESM::Apparatus>().getSize());
+
+    std::vector<boost::filesystem::path> otherContentFiles(mContentFiles.rbegin(), mContentFiles.rend());
+    MWWorld::ESMStore otherContentStore;
+    EXPECT_FALSE (MWWorld::ESMStoreCache(mCachePath, otherContentFiles, ToUTF8::WINDOWS_1252).load(otherContentStore));
+    EXPECT_FALSE (otherContentStore.isLoadedFromCache());
+    EXPECT_EQ (0u, otherContentStore.get<ESM::Apparatus>().getSize());
+}
+
+/// Tests that a cache body that ends in the middle of a record adds none of its records.
+TEST_F(ContentCacheTest, truncated_body_test)
+{
+    std::stringstream stream;
+    ESM::ESMWriter writer;
+    writer.setFormat(0);
+    writer.save(stream);
+    mEsmStore.writeCache(writer);
+    writer.close();
+
+    std::string body = stream.str();
+    body.resize(body.size() - 10);
+
+    ESM::ESMReader reader;
+    reader.open(Files::IStreamPtr(new std::stringstream(body)), "filename");
+
+    MWWorld::ESMStore cachedStore;
+    EXPECT_THROW (cachedStore.loadCache(reader), std::exception);
+    EXPECT_FALSE (cachedStore.isLoadedFromCache());
+    EXPECT_EQ (0u, cachedStore.get<ESM::Apparatus>().getSize());
+    EXPECT_EQ (0u, cachedStore.get<ESM::NPC>().getSize());
+}
+
+/// Load an in-memory ESM file into the store from records decoded ahead of time, the way EsmLoader does.
+void loadStagedEsmFile(MWWorld::ESMStore& esmStore, const std::string& data)
+{
+    MWWorld::ESMStore::StagedContent staged;
+
+    ESM::ESMReader decodeReader;
+    decodeReader.open(Files::IStreamPtr(new std::stringstream(data)), "filename");
+    esmStore.decode(decodeReader, staged);
+
+    ESM::ESMReader reader;
+    std::vector<ESM::ESMReader> readerList;
+    readerList.push_back(reader);
+    reader.setGlobalReaderList(&readerList);
+
+    reader.open(Files::IStreamPtr(new std::stringstream(data)), "filename");
+    esmStore.load(reader, &dummyListener, &staged);
+}
+
+/// Tests that records decoded ahead of time end up in the store the same way as records loaded directly.
+TEST_F(StoreTest, staged_load_test)
+{
+    typedef ESM::Apparatus RecordType;
+
+    RecordType record;
+    record.blank();
+
+    // Dialogues are never decoded ahead of time, so the staged records have to stay in step around them
+    ESM::Dialogue dialogue;
+    dialogue.blank();
+    dialogue.mId = "greeting";
+    dialogue.mType = ESM::Dialogue::Topic;
+
+    // master file inserts some records
+    std::stringstream master;
+    ESM::ESMWriter masterWriter;
+    masterWriter.setFormat(0);
+    masterWriter.save(master);
+    record.mId = "retort";
+    record.mModel = "retort_model";
+    writeRecord(masterWriter, record, false);
+    writeRecord(masterWriter, dialogue, false);
+    record.mId = "mortar";
+    record.mModel = "mortar_model";
+    writeRecord(masterWriter, record, false);
+    record.mId = "calcinator";
+    record.mModel = "calcinator_model";
+    writeRecord(masterWriter, record, false);
+
+    // a plugin deletes one of them, overwrites another and adds a new one
+    std::stringstream plugin;
+    ESM::ESMWriter pluginWriter;
+    pluginWriter.setFormat(0);
+    pluginWriter.save(plugin);
+    record.mId = "mortar";
+    writeRecord(pluginWriter, record, true);
+    record.mId = "Retort";
+    record.mModel = "the_new_model";
+    writeRecord(pluginWriter, record, false);
+    record.mId = "alembic";
+    record.mModel = "alembic_model";
+    writeRecord(pluginWriter, record, false);
+
+    loadEsmFile(mEsmStore, master.str());
+    loadEsmFile(mEsmStore, plugin.str());
+    mEsmStore.setUp();
+
+    MWWorld::ESMStore stagedStore;
+    loadStagedEsmFile(stagedStore, master.str());
+    loadStagedEsmFile(stagedStore, plugin.str());
+    stagedStore.setUp();
+
+    const MWWorld::Store<RecordType>& store = mEsmStore.get<RecordType>();
+    const MWWorld::Store<RecordType>& staged = stagedStore.get<RecordType>();
+    ASSERT_EQ (3u, store.getSize());
+    ASSERT_EQ (store.getSize(), staged.getSize());
+    for (MWWorld::Store<RecordType>::iterator it = store.begin(), stagedIt = staged.begin(); it != store.end(); ++it, ++stagedIt)
+    {
+        EXPECT_EQ (it->mId, stagedIt->mId);
+        EXPECT_EQ (it->mModel, stagedIt->mModel);
+    }
+
+    EXPECT_TRUE (staged.search("mortar") == nullptr);
+    ASSERT_TRUE (staged.search("retort") != nullptr);
+    EXPECT_EQ ("the_new_model", staged.search("retort")->mModel);
+    EXPECT_TRUE (stagedStore.get<ESM::Dialogue>().search("greeting") != nullptr);
+}
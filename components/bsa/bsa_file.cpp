@@ -28,6 +28,8 @@
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem/fstream.hpp>
 
+#include <components/debug/debuglog.hpp>
+
 using namespace std;
 using namespace Bsa;
 
@@ -163,9 +165,30 @@ int BSAFile::getIndex(const char *str) const
 void BSAFile::open(const string &file)
 {
     mFilename = file;
+    mMapping.reset();
+
+    // Serve every file from one mapping of the archive instead of opening it again for each of them.
+    // The mapping is created first so that readHeader() can use it too.
+    try
+    {
+        mMapping = std::make_shared<Files::MappedFile>(mFilename);
+    }
+    catch (std::exception &e)
+    {
+        Log(Debug::Warning) << "Warning: could not map archive " << mFilename << " into memory, reading it through file streams instead: " << e.what();
+    }
+
     readHeader();
 }
 
+Files::IStreamPtr BSAFile::openRegion(size_t offset, size_t size) const
+{
+    if (mMapping)
+        return Files::MappedFile::openStream(mMapping, offset, size);
+
+    return Files::openConstrainedFileStream(mFilename.c_str(), offset, size);
+}
+
 Files::IStreamPtr BSAFile::getFile(const char *file)
 {
     assert(file);
@@ -175,10 +198,10 @@ Files::IStreamPtr BSAFile::getFile(const char *file)
 
     const FileStruct &fs = mFiles[i];
 
-    return Files::openConstrainedFileStream (mFilename.c_str (), fs.offset, fs.fileSize);
+    return openRegion(fs.offset, fs.fileSize);
 }
 
 Files::IStreamPtr BSAFile::getFile(const FileStruct *file)
 {
-    return Files::openConstrainedFileStream (mFilename.c_str (), file->offset, file->fileSize);
+    return openRegion(file->offset, file->fileSize);
 }
@@ -32,6 +32,7 @@
 #include <components/misc/stringops.hpp>
 
 #include <components/files/constrainedfilestream.hpp>
+#include <components/files/mappedfile.hpp>
 
 
 namespace Bsa
@@ -69,6 +70,9 @@ protected:
     /// Used for error messages
     std::string mFilename;
 
+    /// The whole archive mapped into memory, or null if it could not be mapped
+    Files::MappedFilePtr mMapping;
+
     /// Case insensitive string comparison
     struct iltstr
     {
@@ -96,6 +100,10 @@ protected:
     /// @note Thread safe.
     int getIndex(const char *str) const;
 
+    /// Open a stream over a region of the archive, served from its mapping when there is one
+    /// @note Thread safe.
+    Files::IStreamPtr openRegion(size_t offset, size_t size) const;
+
 public:
     /* -----------------------------------
      * BSA management methods
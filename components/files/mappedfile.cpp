@@ -0,0 +1,48 @@
+#include "mappedfile.hpp"
+
+#include <algorithm>
+
+#include "memorystream.hpp"
+
+namespace
+{
+    struct MappedFileStream : Files::IMemStream
+    {
+        MappedFileStream(const Files::MappedFilePtr &file, const char *buffer, size_t size)
+            : Files::MemBuf(buffer, size)
+            , Files::IMemStream(buffer, size)
+            , mFile(file)
+        {
+        }
+
+        Files::MappedFilePtr mFile;
+    };
+}
+
+namespace Files
+{
+
+MappedFile::MappedFile(const std::string &filename)
+    : mSource(filename)
+{
+}
+
+const char *MappedFile::data() const
+{
+    return mSource.data();
+}
+
+size_t MappedFile::size() const
+{
+    return mSource.size();
+}
+
+IStreamPtr MappedFile::openStream(const MappedFilePtr &file, size_t start, size_t length)
+{
+    start = std::min(start, file->size());
+    length = std::min(length, file->size() - start);
+
+    return std::make_shared<MappedFileStream>(file, file->data() + start, length);
+}
+
+}
@@ -0,0 +1,37 @@
+#ifndef OPENMW_COMPONENTS_FILES_MAPPEDFILE_H
+#define OPENMW_COMPONENTS_FILES_MAPPEDFILE_H
+
+#include <memory>
+#include <string>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include "constrainedfilestream.hpp"
+
+namespace Files
+{
+
+/// A whole file mapped read-only into memory, over which any number of streams can be opened
+/// without a file handle or a copy of their own.
+class MappedFile
+{
+public:
+    /// @throws std::exception if the file can't be mapped
+    explicit MappedFile(const std::string &filename);
+
+    const char *data() const;
+    size_t size() const;
+
+    /// Open a stream over a region of the file, which keeps the mapping alive for as long as it exists.
+    /// @note Thread safe.
+    static IStreamPtr openStream(const std::shared_ptr<const MappedFile> &file, size_t start, size_t length);
+
+private:
+    boost::iostreams::mapped_file_source mSource;
+};
+
+typedef std::shared_ptr<const MappedFile> MappedFilePtr;
+
+}
+
+#endif
@@ -63,3 +63,9 @@ bool mwmp::ActorPacketController::ContainsPacket(RakNet::MessageID id)
     }
     return false;
 }
+
+void mwmp::ActorPacketController::ForgetConnection(RakNet::RakNetGUID guid)
+{
+    for (const auto &packet : packets)
+        packet.second->forgetConnection(guid);
+}
@@ -90,3 +90,9 @@ bool mwmp::ObjectPacketController::ContainsPacket(RakNet::MessageID id)
     }
     return false;
 }
+
+void mwmp::ObjectPacketController::ForgetConnection(RakNet::RakNetGUID guid)
+{
+    for (const auto &packet : packets)
+        packet.second->forgetConnection(guid);
+}
@@ -119,3 +119,9 @@ bool mwmp::PlayerPacketController::ContainsPacket(RakNet::MessageID id)
     }
     return false;
 }
+
+void mwmp::PlayerPacketController::ForgetConnection(RakNet::RakNetGUID guid)
+{
+    for (const auto &packet : packets)
+        packet.second->forgetConnection(guid);
+}
@@ -17,6 +17,7 @@ namespace mwmp
         void SetStream(RakNet::BitStream *inStream, RakNet::BitStream *outStream);
 
         bool ContainsPacket(RakNet::MessageID id);
+        void ForgetConnection(RakNet::RakNetGUID guid);
 
         typedef std::unordered_map<unsigned char, std::unique_ptr<PlayerPacket> > packets_t;
     private:
@@ -47,12 +47,17 @@ void ActorPacket::Packet(RakNet::BitStream *bs, bool send)
     }
 }
 
+bool ActorPacket::ReadHeader()
+{
+    return PacketHeader(bsRead, false) && packetValid;
+}
+
 bool ActorPacket::PacketHeader(RakNet::BitStream *bs, bool send)
 {
     BasePacket::Packet(bs, send);
 
     RW(actorList->cell.mData, send, true);
-    RW(actorList->cell.mName, send, true);
+    RWIndexed(actorList->cell.mName, send, true);
 
     if (send)
         actorList->count = (unsigned int)(actorList->baseActors.size());
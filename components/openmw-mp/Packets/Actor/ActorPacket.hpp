@@ -22,6 +22,15 @@ namespace mwmp
         void setActorList(BaseActorList *actorList);
 
         virtual void Packet(RakNet::BitStream *bs, bool send);
+
+        // Read only the cell and the actor count, leaving the read stream at the first actor
+        bool ReadHeader();
+
+        // Get the number of bits every actor takes up in the packet, or 0 if it differs between actors
+        virtual uint32_t getActorBits() const
+        {
+            return 0;
+        }
     protected:
         bool PacketHeader(RakNet::BitStream *bs, bool send);
         virtual void Actor(BaseActor &actor, bool send);
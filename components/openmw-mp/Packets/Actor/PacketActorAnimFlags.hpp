@@ -11,6 +11,12 @@ namespace mwmp
         PacketActorAnimFlags(RakNet::RakPeerInterface *peer);
 
         virtual void Actor(BaseActor &actor, bool send);
+
+        virtual uint32_t getActorBits() const
+        {
+            // refNum, mpNum, movementFlags, drawState and isFlying
+            return 32 + 32 + 32 + 8 + 1;
+        }
     };
 }
 
@@ -13,5 +13,5 @@ void PacketActorAuthority::Packet(RakNet::BitStream *bs, bool send)
     BasePacket::Packet(bs, send);
 
     RW(actorList->cell.mData, send, true);
-    RW(actorList->cell.mName, send, true);
+    RWIndexed(actorList->cell.mName, send, true);
 }
@@ -12,7 +12,7 @@ PacketActorCellChange::PacketActorCellChange(RakNet::RakPeerInterface *peer) : A
 void PacketActorCellChange::Actor(BaseActor &actor, bool send)
 {
     RW(actor.cell.mData, send, true);
-    RW(actor.cell.mName, send, true);
+    RWIndexed(actor.cell.mName, send, true);
 
     RW(actor.position, send, true);
     RW(actor.direction, send, true);
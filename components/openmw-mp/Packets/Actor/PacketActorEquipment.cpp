@@ -13,7 +13,7 @@ void PacketActorEquipment::Actor(BaseActor &actor, bool send)
 {
     for (auto &&equipmentItem : actor.equipmentItems)
     {
-        RW(equipmentItem.refId, send);
+        RWIndexed(equipmentItem.refId, send);
         RW(equipmentItem.count, send);
         RW(equipmentItem.charge, send);
         RW(equipmentItem.enchantmentCharge, send);
@@ -22,7 +22,7 @@ void PacketActorList::Packet(RakNet::BitStream *bs, bool send)
         if (send)
             actor = actorList->baseActors.at(i);
 
-        RW(actor.refId, send);
+        RWIndexed(actor.refId, send);
         RW(actor.refNum, send);
         RW(actor.mpNum, send);
 
@@ -11,8 +11,42 @@ PacketActorPosition::PacketActorPosition(RakNet::RakPeerInterface *peer) : Actor
 
 void PacketActorPosition::Actor(BaseActor &actor, bool send)
 {
-    RW(actor.position, send, true);
-    RW(actor.direction, send, true);
+    uint64_t subject = getSubject(actor.refNum, actor.mpNum);
+
+    if (send)
+    {
+        bool allowDelta = connectionGuid != RakNet::UNASSIGNED_CRABNET_GUID;
+        positionCodec.write(bs, connectionGuid, subject, actor.position, actor.direction, allowDelta);
+    }
+    else
+    {
+        bool hasState;
+        if (!positionCodec.read(bs, connectionGuid, subject, actor.position, actor.direction, hasState))
+        {
+            packetValid = false;
+            hasState = false;
+        }
+
+        // Actors whose position could not be reconstructed from a delta are left where they are
+        actor.hasPositionData = hasState;
+        return;
+    }
 
     actor.hasPositionData = true;
 }
+
+void PacketActorPosition::forgetConnection(RakNet::RakNetGUID connection)
+{
+    ActorPacket::forgetConnection(connection);
+    positionCodec.forgetConnection(connection);
+}
+
+void PacketActorPosition::forgetActor(RakNet::RakNetGUID connection, unsigned int refNum, unsigned int mpNum)
+{
+    positionCodec.forgetSubject(connection, getSubject(refNum, mpNum));
+}
+
+uint64_t PacketActorPosition::getSubject(unsigned int refNum, unsigned int mpNum)
+{
+    return (static_cast<uint64_t>(refNum) << 32) | mpNum;
+}
@@ -2,6 +2,7 @@
 #define OPENMW_PACKETACTORPOSITION_HPP
 
 #include <components/openmw-mp/Packets/Actor/ActorPacket.hpp>
+#include <components/openmw-mp/Packets/PositionDeltaCodec.hpp>
 
 namespace mwmp
 {
@@ -11,6 +12,22 @@ namespace mwmp
         PacketActorPosition(RakNet::RakPeerInterface *peer);
 
         virtual void Actor(BaseActor &actor, bool send);
+
+        virtual bool hasPerConnectionEncoding() const
+        {
+            return true;
+        }
+
+        virtual void forgetConnection(RakNet::RakNetGUID connection);
+
+        // Drop the position last sent or received for an actor over a connection that no longer
+        // has it loaded
+        void forgetActor(RakNet::RakNetGUID connection, unsigned int refNum, unsigned int mpNum);
+
+    private:
+        static uint64_t getSubject(unsigned int refNum, unsigned int mpNum);
+
+        PositionDeltaCodec positionCodec;
     };
 }
 
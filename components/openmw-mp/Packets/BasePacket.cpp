@@ -5,12 +5,18 @@
 
 using namespace mwmp;
 
+uint64_t BasePacket::bytesEncoded = 0;
+uint64_t BasePacket::bytesSent = 0;
+uint64_t BasePacket::sentCountByPacket[256] = {};
+uint64_t BasePacket::bytesSentByPacket[256] = {};
+
 BasePacket::BasePacket(RakNet::RakPeerInterface *peer)
 {
     packetID = 0;
     priority = HIGH_PRIORITY;
     reliability = RELIABLE_ORDERED;
     orderChannel = CHANNEL_SYSTEM;
+    connectionGuid = RakNet::UNASSIGNED_CRABNET_GUID;
     this->peer = peer;
 }
 
@@ -54,16 +60,73 @@ uint32_t BasePacket::RequestData(RakNet::RakNetGUID guid)
 
 uint32_t BasePacket::Send(RakNet::AddressOrGUID destination)
 {
-    bsSend->ResetWritePointer();
-    Packet(bsSend, true);
-    return peer->Send(bsSend, priority, reliability, orderChannel, destination, false);
+    // Let packets with per-connection encoding know which connection they are being written for
+    connectionGuid = destination.rakNetGuid;
+    Serialize();
+    connectionGuid = RakNet::UNASSIGNED_CRABNET_GUID;
+
+    return sendStream(destination, false);
 }
 
 uint32_t BasePacket::Send(bool toOther)
+{
+    // A packet that isn't sent to others only goes to the connection with our guid
+    if (!toOther)
+        connectionGuid = guid;
+
+    Serialize();
+    connectionGuid = RakNet::UNASSIGNED_CRABNET_GUID;
+
+    return sendStream(guid, toOther);
+}
+
+void BasePacket::Serialize()
 {
     bsSend->ResetWritePointer();
     Packet(bsSend, true);
-    return peer->Send(bsSend, priority, reliability, orderChannel, guid, toOther);
+    bytesEncoded += bsSend->GetNumberOfBytesUsed();
+}
+
+uint32_t BasePacket::SendSerialized(RakNet::AddressOrGUID destination)
+{
+    return sendStream(destination, false);
+}
+
+uint32_t BasePacket::Relay(const unsigned char *data, uint32_t length, RakNet::AddressOrGUID destination)
+{
+    bytesSent += length;
+    sentCountByPacket[data[0]]++;
+    bytesSentByPacket[data[0]] += length;
+    return peer->Send(reinterpret_cast<const char *>(data), (int) length, priority, reliability, orderChannel,
+        destination, false);
+}
+
+uint32_t BasePacket::sendStream(RakNet::AddressOrGUID destination, bool broadcast)
+{
+    bytesSent += bsSend->GetNumberOfBytesUsed();
+    sentCountByPacket[packetID]++;
+    bytesSentByPacket[packetID] += bsSend->GetNumberOfBytesUsed();
+    return peer->Send(bsSend, priority, reliability, orderChannel, destination, broadcast);
+}
+
+uint64_t BasePacket::getBytesEncoded()
+{
+    return bytesEncoded;
+}
+
+uint64_t BasePacket::getBytesSent()
+{
+    return bytesSent;
+}
+
+uint64_t BasePacket::getSentCount(RakNet::MessageID packetID)
+{
+    return sentCountByPacket[packetID];
+}
+
+uint64_t BasePacket::getBytesSent(RakNet::MessageID packetID)
+{
+    return bytesSentByPacket[packetID];
 }
 
 void BasePacket::Read()
@@ -71,6 +134,77 @@ void BasePacket::Read()
     Packet(bsRead, false);
 }
 
+void BasePacket::forgetConnection(RakNet::RakNetGUID connection)
+{
+    stringDictionary.forgetConnection(connection);
+}
+
+bool BasePacket::RWIndexed(std::string &str, bool write, bool compress)
+{
+    bool hasConnection = connectionGuid != RakNet::UNASSIGNED_CRABNET_GUID;
+    bool isIndexed;
+    bool isAdded;
+    uint16_t index;
+
+    if (write)
+    {
+        isIndexed = hasConnection && stringDictionary.getIndex(connectionGuid, str, index);
+        bs->Write(isIndexed);
+
+        if (isIndexed)
+        {
+            bs->WriteCompressed(index);
+            return true;
+        }
+
+        RW(str, true, compress);
+
+        isAdded = hasConnection && str.size() <= maxStrSize && stringDictionary.addString(connectionGuid, str, index);
+        bs->Write(isAdded);
+
+        if (isAdded)
+            bs->WriteCompressed(index);
+
+        return true;
+    }
+
+    if (!bs->Read(isIndexed))
+    {
+        packetValid = false;
+        return false;
+    }
+
+    if (isIndexed)
+    {
+        if (bs->ReadCompressed(index) && stringDictionary.getString(connectionGuid, index, str))
+            return true;
+
+        // An index we never assigned means the rest of the packet can't be trusted either
+        str = std::string();
+        packetValid = false;
+        return false;
+    }
+
+    if (!RW(str, false, compress) || !bs->Read(isAdded))
+    {
+        packetValid = false;
+        return false;
+    }
+
+    if (isAdded)
+    {
+        if (!bs->ReadCompressed(index))
+        {
+            packetValid = false;
+            return false;
+        }
+
+        stringDictionary.setString(connectionGuid, index, str);
+    }
+
+    return true;
+}
+
 void BasePacket::setGUID(RakNet::RakNetGUID guid)
 {
     this->guid = guid;
@@ -6,6 +6,7 @@
 #include <BitStream.h>
 #include <PacketPriority.h>
 
+#include "StringDictionary.hpp"
 
 namespace mwmp
 {
@@ -21,6 +22,32 @@ namespace mwmp
         virtual uint32_t Send(RakNet::AddressOrGUID destination);
         virtual void Read();
 
+        // Serialize the packet into the send stream once, so the same bytes can then be
+        // handed to any number of recipients through SendSerialized()
+        void Serialize();
+        uint32_t SendSerialized(RakNet::AddressOrGUID destination);
+
+        // Send the bytes of a packet received from another connection as they are, using this
+        // packet's priority, reliability and channel
+        uint32_t Relay(const unsigned char *data, uint32_t length, RakNet::AddressOrGUID destination);
+
+        // Whether the packet encodes its contents differently for each connection, in which case
+        // it has to be sent separately to each recipient through Send(destination)
+        virtual bool hasPerConnectionEncoding() const
+        {
+            return false;
+        }
+
+        // Drop any state kept about a connection that has been closed
+        virtual void forgetConnection(RakNet::RakNetGUID connection);
+
+        static uint64_t getBytesEncoded();
+        static uint64_t getBytesSent();
+
+        // Get the number of packets with an ID handed to the network and their total size
+        static uint64_t getSentCount(RakNet::MessageID packetID);
+        static uint64_t getBytesSent(RakNet::MessageID packetID);
+
         void setGUID(RakNet::RakNetGUID guid);
         RakNet::RakNetGUID getGUID();
 
@@ -92,7 +119,12 @@ namespace mwmp
             if (write)
             {
                 if (compress)
-                    RakNet::RakString::SerializeCompressed(str.substr(0, maxSize).c_str(), bs); // todo: remove extra copy of string
+                {
+                    if (str.size() > maxSize)
+                        RakNet::RakString::SerializeCompressed(str.substr(0, maxSize).c_str(), bs);
+                    else
+                        RakNet::RakString::SerializeCompressed(str.c_str(), bs);
+                }
                 else
                 {
                     RakNet::RakString rstr;
@@ -119,6 +151,11 @@ namespace mwmp
             return res;
         }
 
+        // Read or write a string that is likely to be sent again, such as a refId or a cell name,
+        // replacing it with its index in the packet's dictionary when the packet is being written
+        // for a single connection that has already received it; a failed read marks the packet invalid
+        bool RWIndexed(std::string &str, bool write, bool compress = false);
+
     protected:
         uint8_t packetID;
         PacketReliability reliability;
@@ -128,6 +165,19 @@ namespace mwmp
         RakNet::RakPeerInterface *peer;
         RakNet::RakNetGUID guid;
         bool packetValid;
+
+        // The single connection the packet is currently being written for, if any
+        RakNet::RakNetGUID connectionGuid;
+
+        StringDictionary stringDictionary;
+
+    private:
+        uint32_t sendStream(RakNet::AddressOrGUID destination, bool broadcast);
+
+        static uint64_t bytesEncoded;
+        static uint64_t bytesSent;
+        static uint64_t sentCountByPacket[256];
+        static uint64_t bytesSentByPacket[256];
     };
 }
 
@@ -71,7 +71,7 @@ bool ObjectPacket::PacketHeader(RakNet::BitStream *bs, bool send)
     if (hasCellData)
     {
         RW(objectList->cell.mData, send, true);
-        RW(objectList->cell.mName, send, true);
+        RWIndexed(objectList->cell.mName, send, true);
     }
 
     return true;
@@ -79,7 +79,7 @@ bool ObjectPacket::PacketHeader(RakNet::BitStream *bs, bool send)
 
 void ObjectPacket::Object(BaseObject &baseObject, bool send)
 {
-    RW(baseObject.refId, send);
+    RWIndexed(baseObject.refId, send);
     RW(baseObject.refNum, send);
     RW(baseObject.mpNum, send);
 }
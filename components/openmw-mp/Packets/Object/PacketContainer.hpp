@@ -11,6 +11,13 @@ namespace mwmp
         PacketContainer(RakNet::RakPeerInterface *peer);
 
         virtual void Packet(RakNet::BitStream *bs, bool send);
+
+        // Container contents are mostly refIds that each client has already been sent, so
+        // write them separately for each connection to make use of its string dictionary
+        virtual bool hasPerConnectionEncoding() const
+        {
+            return true;
+        }
     };
 }
 
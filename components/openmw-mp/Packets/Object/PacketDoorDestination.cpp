@@ -18,7 +18,7 @@ void PacketDoorDestination::Object(BaseObject &baseObject, bool send)
     if (baseObject.teleportState)
     {
         RW(baseObject.destinationCell.mData, send, true);
-        RW(baseObject.destinationCell.mName, send, true);
+        RWIndexed(baseObject.destinationCell.mName, send, true);
 
         RW(baseObject.destinationPosition.pos, send, true);
         RW(baseObject.destinationPosition.rot[0], send, true);
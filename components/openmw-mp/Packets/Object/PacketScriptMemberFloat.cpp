@@ -10,7 +10,7 @@ PacketScriptMemberFloat::PacketScriptMemberFloat(RakNet::RakPeerInterface *peer)
 
 void PacketScriptMemberFloat::Object(BaseObject &baseObject, bool send)
 {
-    RW(baseObject.refId, send);
+    RWIndexed(baseObject.refId, send);
     RW(baseObject.index, send);
     RW(baseObject.floatVal, send);
 }
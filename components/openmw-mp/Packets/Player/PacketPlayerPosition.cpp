@@ -9,12 +9,36 @@ PacketPlayerPosition::PacketPlayerPosition(RakNet::RakPeerInterface *peer) : Pla
     packetID = ID_PLAYER_POSITION;
     priority = MEDIUM_PRIORITY;
     //reliability = UNRELIABLE_SEQUENCED;
+    positionData = false;
 }
 
 void PacketPlayerPosition::Packet(RakNet::BitStream *bs, bool send)
 {
     PlayerPacket::Packet(bs, send);
 
-    RW(player->position, send, 1);
-    RW(player->direction, send, 1);
+    if (send)
+    {
+        bool allowDelta = connectionGuid != RakNet::UNASSIGNED_CRABNET_GUID;
+        positionCodec.write(bs, connectionGuid, player->guid.g, player->position, player->direction, allowDelta);
+    }
+    else
+    {
+        // Keep the last known position if this was a delta we had no base for
+        if (!positionCodec.read(bs, connectionGuid, player->guid.g, player->position, player->direction, positionData))
+        {
+            packetValid = false;
+            positionData = false;
+        }
+    }
+}
+
+void PacketPlayerPosition::forgetConnection(RakNet::RakNetGUID connection)
+{
+    PlayerPacket::forgetConnection(connection);
+    positionCodec.forgetConnection(connection);
+}
+
+void PacketPlayerPosition::forgetPlayer(RakNet::RakNetGUID connection, RakNet::RakNetGUID player)
+{
+    positionCodec.forgetSubject(connection, player.g);
 }
@@ -2,6 +2,7 @@
 #define OPENMW_PACKETPLAYERPOSITION_HPP
 
 #include <components/openmw-mp/Packets/Player/PlayerPacket.hpp>
+#include <components/openmw-mp/Packets/PositionDeltaCodec.hpp>
 
 namespace mwmp
 {
@@ -11,6 +12,27 @@ namespace mwmp
         PacketPlayerPosition(RakNet::RakPeerInterface *peer);
 
         virtual void Packet(RakNet::BitStream *bs, bool send);
+
+        virtual bool hasPerConnectionEncoding() const
+        {
+            return true;
+        }
+
+        virtual void forgetConnection(RakNet::RakNetGUID connection);
+
+        // Drop the position last sent or received for a player over a connection that no longer
+        // receives it
+        void forgetPlayer(RakNet::RakNetGUID connection, RakNet::RakNetGUID player);
+
+        // Whether the last packet read carried a position, rather than a delta we had no base for
+        bool hasPositionData() const
+        {
+            return positionData;
+        }
+
+    private:
+        PositionDeltaCodec positionCodec;
+        bool positionData;
     };
 }
 
@@ -0,0 +1,203 @@
+#include "PositionDeltaCodec.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace mwmp;
+
+// Positions are kept to an eighth of a game unit, while rotations and directions are kept to
+// around a four-thousandth of a radian
+static const float positionScale = 8.0f;
+static const float angleScale = 4096.0f;
+
+PositionDeltaCodec::PositionDeltaCodec()
+{
+
+}
+
+void PositionDeltaCodec::write(RakNet::BitStream *bs, RakNet::RakNetGUID connection, uint64_t subject,
+    const ESM::Position &position, const ESM::Position &direction, bool allowDelta)
+{
+    int32_t fields[fieldCount];
+    quantize(position, direction, fields);
+
+    if (!allowDelta)
+    {
+        bs->Write(false); // isDelta
+        bs->Write(false); // isKeyframe
+
+        for (unsigned int i = 0; i < fieldCount; i++)
+            bs->WriteCompressed(zigzagEncode(fields[i]));
+
+        return;
+    }
+
+    Snapshot &snapshot = snapshots[connection.g][subject];
+
+    bool isDelta = snapshot.isValid && snapshot.deltasSinceKeyframe < keyframeInterval;
+    uint8_t sequence = snapshot.isValid ? snapshot.sequence + 1 : 0;
+
+    bs->Write(isDelta);
+
+    if (isDelta)
+    {
+        uint16_t changedFields = 0;
+
+        for (unsigned int i = 0; i < fieldCount; i++)
+        {
+            if (fields[i] != snapshot.fields[i])
+                changedFields |= 1 << i;
+        }
+
+        bs->Write(sequence);
+        bs->Write(changedFields);
+
+        for (unsigned int i = 0; i < fieldCount; i++)
+        {
+            if (changedFields & (1 << i))
+                bs->WriteCompressed(zigzagEncode(fields[i] - snapshot.fields[i]));
+        }
+
+        snapshot.deltasSinceKeyframe++;
+    }
+    else
+    {
+        bs->Write(true); // isKeyframe
+        bs->Write(sequence);
+
+        for (unsigned int i = 0; i < fieldCount; i++)
+            bs->WriteCompressed(zigzagEncode(fields[i]));
+
+        snapshot.deltasSinceKeyframe = 0;
+    }
+
+    std::copy(fields, fields + fieldCount, snapshot.fields);
+    snapshot.sequence = sequence;
+    snapshot.isValid = true;
+}
+
+bool PositionDeltaCodec::read(RakNet::BitStream *bs, RakNet::RakNetGUID connection, uint64_t subject,
+    ESM::Position &position, ESM::Position &direction, bool &hasState)
+{
+    bool isDelta;
+    bool isKeyframe = false;
+    uint8_t sequence = 0;
+    int32_t fields[fieldCount];
+
+    hasState = false;
+
+    if (!bs->Read(isDelta))
+        return false;
+
+    if (isDelta)
+    {
+        uint16_t changedFields;
+
+        if (!bs->Read(sequence) || !bs->Read(changedFields))
+            return false;
+
+        Snapshot &snapshot = snapshots[connection.g][subject];
+
+        for (unsigned int i = 0; i < fieldCount; i++)
+        {
+            fields[i] = snapshot.fields[i];
+
+            if (changedFields & (1 << i))
+            {
+                uint32_t encodedDifference;
+
+                if (!bs->ReadCompressed(encodedDifference))
+                    return false;
+
+                fields[i] += zigzagDecode(encodedDifference);
+            }
+        }
+
+        // We missed a snapshot from this stream, so wait for the next keyframe
+        if (!snapshot.isValid || snapshot.sequence != static_cast<uint8_t>(sequence - 1))
+        {
+            snapshot.isValid = false;
+            return true;
+        }
+    }
+    else
+    {
+        if (!bs->Read(isKeyframe))
+            return false;
+
+        if (isKeyframe && !bs->Read(sequence))
+            return false;
+
+        for (unsigned int i = 0; i < fieldCount; i++)
+        {
+            uint32_t encodedField;
+
+            if (!bs->ReadCompressed(encodedField))
+                return false;
+
+            fields[i] = zigzagDecode(encodedField);
+        }
+    }
+
+    if (isDelta || isKeyframe)
+    {
+        Snapshot &snapshot = snapshots[connection.g][subject];
+        std::copy(fields, fields + fieldCount, snapshot.fields);
+        snapshot.sequence = sequence;
+        snapshot.isValid = true;
+    }
+
+    dequantize(fields, position, direction);
+    hasState = true;
+    return true;
+}
+
+void PositionDeltaCodec::forgetConnection(RakNet::RakNetGUID connection)
+{
+    snapshots.erase(connection.g);
+}
+
+void PositionDeltaCodec::forgetSubject(RakNet::RakNetGUID connection, uint64_t subject)
+{
+    auto connectionSnapshots = snapshots.find(connection.g);
+
+    if (connectionSnapshots == snapshots.end())
+        return;
+
+    connectionSnapshots->second.erase(subject);
+
+    if (connectionSnapshots->second.empty())
+        snapshots.erase(connectionSnapshots);
+}
+
+void PositionDeltaCodec::quantize(const ESM::Position &position, const ESM::Position &direction, int32_t *fields)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        fields[i] = static_cast<int32_t>(std::lround(position.pos[i] * positionScale));
+        fields[3 + i] = static_cast<int32_t>(std::lround(position.rot[i] * angleScale));
+        fields[6 + i] = static_cast<int32_t>(std::lround(direction.pos[i] * angleScale));
+        fields[9 + i] = static_cast<int32_t>(std::lround(direction.rot[i] * angleScale));
+    }
+}
+
+void PositionDeltaCodec::dequantize(const int32_t *fields, ESM::Position &position, ESM::Position &direction)
+{
+    for (int i = 0; i < 3; i++)
+    {
+        position.pos[i] = fields[i] / positionScale;
+        position.rot[i] = fields[3 + i] / angleScale;
+        direction.pos[i] = fields[6 + i] / angleScale;
+        direction.rot[i] = fields[9 + i] / angleScale;
+    }
+}
+
+uint32_t PositionDeltaCodec::zigzagEncode(int32_t value)
+{
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int32_t PositionDeltaCodec::zigzagDecode(uint32_t value)
+{
+    return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
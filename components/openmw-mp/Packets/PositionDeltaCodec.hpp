@@ -0,0 +1,68 @@
+#ifndef OPENMW_POSITIONDELTACODEC_HPP
+#define OPENMW_POSITIONDELTACODEC_HPP
+
+#include <cstdint>
+#include <unordered_map>
+
+#include <BitStream.h>
+#include <RakNetTypes.h>
+
+#include <components/esm/defs.hpp>
+
+namespace mwmp
+{
+    /*
+        Serializes a position and direction pair either as a full snapshot or as a delta against
+        the last snapshot written for the same subject over the same connection
+
+        Values are quantized before being compared and written, so a delta only contains the fields
+        that changed by at least one quantization step. Snapshots written for a single connection
+        form a numbered stream, and a delta can only be applied on top of the snapshot right before
+        it; when a receiver has missed one, it keeps its last known state until the next keyframe,
+        which is sent at least every keyframeInterval snapshots. Snapshots written without a single
+        connection, such as broadcasts, are always full and stay outside of any stream.
+    */
+    class PositionDeltaCodec
+    {
+    public:
+        PositionDeltaCodec();
+
+        void write(RakNet::BitStream *bs, RakNet::RakNetGUID connection, uint64_t subject,
+            const ESM::Position &position, const ESM::Position &direction, bool allowDelta);
+
+        // Returns false if the stream ended early, and leaves position and direction untouched
+        // if the snapshot could not be reconstructed, as indicated through hasState
+        bool read(RakNet::BitStream *bs, RakNet::RakNetGUID connection, uint64_t subject,
+            ESM::Position &position, ESM::Position &direction, bool &hasState);
+
+        void forgetConnection(RakNet::RakNetGUID connection);
+
+        // Drop the last snapshot of a subject that is no longer sent over a connection, so that
+        // the next one written for it is a keyframe
+        void forgetSubject(RakNet::RakNetGUID connection, uint64_t subject);
+
+    private:
+        static const unsigned int fieldCount = 12;
+        static const uint8_t keyframeInterval = 16;
+
+        struct Snapshot
+        {
+            Snapshot() : fields(), sequence(0), deltasSinceKeyframe(0), isValid(false) {}
+
+            int32_t fields[fieldCount];
+            uint8_t sequence;
+            uint8_t deltasSinceKeyframe;
+            bool isValid;
+        };
+
+        static void quantize(const ESM::Position &position, const ESM::Position &direction, int32_t *fields);
+        static void dequantize(const int32_t *fields, ESM::Position &position, ESM::Position &direction);
+
+        static uint32_t zigzagEncode(int32_t value);
+        static int32_t zigzagDecode(uint32_t value);
+
+        std::unordered_map<uint64_t, std::unordered_map<uint64_t, Snapshot>> snapshots;
+    };
+}
+
+#endif //OPENMW_POSITIONDELTACODEC_HPP
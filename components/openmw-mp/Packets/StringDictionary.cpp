@@ -0,0 +1,60 @@
+#include "StringDictionary.hpp"
+
+using namespace mwmp;
+
+bool StringDictionary::getIndex(RakNet::RakNetGUID connection, const std::string &str, uint16_t &index) const
+{
+    auto connectionIt = connections.find(connection.g);
+
+    if (connectionIt == connections.end())
+        return false;
+
+    auto it = connectionIt->second.indexes.find(str);
+
+    if (it == connectionIt->second.indexes.end())
+        return false;
+
+    index = it->second;
+    return true;
+}
+
+bool StringDictionary::addString(RakNet::RakNetGUID connection, const std::string &str, uint16_t &index)
+{
+    Entries &entries = connections[connection.g];
+
+    if (entries.indexes.size() >= maxEntries)
+        return false;
+
+    index = static_cast<uint16_t>(entries.indexes.size());
+    entries.indexes.emplace(str, index);
+    return true;
+}
+
+bool StringDictionary::getString(RakNet::RakNetGUID connection, uint16_t index, std::string &str) const
+{
+    auto connectionIt = connections.find(connection.g);
+
+    if (connectionIt == connections.end() || index >= connectionIt->second.strings.size())
+        return false;
+
+    str = connectionIt->second.strings[index];
+    return true;
+}
+
+void StringDictionary::setString(RakNet::RakNetGUID connection, uint16_t index, const std::string &str)
+{
+    if (index >= maxEntries)
+        return;
+
+    Entries &entries = connections[connection.g];
+
+    if (index >= entries.strings.size())
+        entries.strings.resize(index + 1);
+
+    entries.strings[index] = str;
+}
+
+void StringDictionary::forgetConnection(RakNet::RakNetGUID connection)
+{
+    connections.erase(connection.g);
+}
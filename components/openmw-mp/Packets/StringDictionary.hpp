@@ -0,0 +1,47 @@
+#ifndef OPENMW_STRINGDICTIONARY_HPP
+#define OPENMW_STRINGDICTIONARY_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <RakNetTypes.h>
+
+namespace mwmp
+{
+    /*
+        Assigns indexes to strings that are sent repeatedly over the same connection, such as refIds
+        and cell names, so they only need to be sent in full the first time
+
+        The writing side looks up indexes by string, while the reading side looks up strings by
+        index, and both sides fill in their entries in the same order as long as every packet
+        written for a connection is also read on the other end of it
+    */
+    class StringDictionary
+    {
+    public:
+        static const uint16_t maxEntries = 4096;
+
+        bool getIndex(RakNet::RakNetGUID connection, const std::string &str, uint16_t &index) const;
+
+        // Returns false if there is no room left for the string
+        bool addString(RakNet::RakNetGUID connection, const std::string &str, uint16_t &index);
+
+        bool getString(RakNet::RakNetGUID connection, uint16_t index, std::string &str) const;
+        void setString(RakNet::RakNetGUID connection, uint16_t index, const std::string &str);
+
+        void forgetConnection(RakNet::RakNetGUID connection);
+
+    private:
+        struct Entries
+        {
+            std::unordered_map<std::string, uint16_t> indexes;
+            std::vector<std::string> strings;
+        };
+
+        std::unordered_map<uint64_t, Entries> connections;
+    };
+}
+
+#endif //OPENMW_STRINGDICTIONARY_HPP
@@ -1,27 +1,212 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
 #include <iostream>
 #include <cstring>
 #include <ctime>
 #include <cstdio>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <boost/lexical_cast.hpp>
 #include "TimedLog.hpp"
 
 using namespace std;
 
+/*
+    Moves the writing of log messages off the threads that produce them
+
+    Messages go into a bounded lock-free ring buffer, and a background thread periodically takes
+    everything out of it and writes it in one go. When the ring buffer is full, messages are
+    dropped and counted instead of stalling the caller.
+*/
+class AsyncLogWriter
+{
+public:
+    AsyncLogWriter() : buffer(new Slot[capacity]), enqueuePos(0), dequeuePos(0), droppedCount(0),
+        reportedDroppedCount(0), isRunning(true)
+    {
+        for (size_t i = 0; i < capacity; i++)
+            buffer[i].sequence.store(i, memory_order_relaxed);
+
+        writerThread = thread(&AsyncLogWriter::run, this);
+    }
+
+    ~AsyncLogWriter()
+    {
+        {
+            lock_guard<mutex> lock(wakeMutex);
+            isRunning = false;
+        }
+        wakeCondition.notify_one();
+        writerThread.join();
+    }
+
+    void push(string &&message)
+    {
+        if (!tryPush(move(message)))
+            droppedCount.fetch_add(1, memory_order_relaxed);
+    }
+
+    // Write out everything queued so far followed by this message, without waiting for the next batch
+    void pushAndFlush(string &&message)
+    {
+        lock_guard<mutex> lock(outputMutex);
+        string batch = takeBatch();
+        batch += message;
+        cout << batch << flush;
+    }
+
+    unsigned long long getDroppedCount() const
+    {
+        return droppedCount.load(memory_order_relaxed);
+    }
+
+private:
+    struct Slot
+    {
+        atomic<size_t> sequence;
+        string message;
+    };
+
+    static const size_t capacity = 8192; // Must be a power of two
+    static const size_t mask = capacity - 1;
+
+    bool tryPush(string &&message)
+    {
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        Slot *slot;
+
+        while (true)
+        {
+            slot = &buffer[pos & mask];
+            size_t sequence = slot->sequence.load(memory_order_acquire);
+            intptr_t difference = (intptr_t) sequence - (intptr_t) pos;
+
+            if (difference == 0)
+            {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+                return false;
+            else
+                pos = enqueuePos.load(memory_order_relaxed);
+        }
+
+        slot->message = move(message);
+        slot->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    bool tryPop(string &message)
+    {
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        Slot *slot;
+
+        while (true)
+        {
+            slot = &buffer[pos & mask];
+            size_t sequence = slot->sequence.load(memory_order_acquire);
+            intptr_t difference = (intptr_t) sequence - (intptr_t) (pos + 1);
+
+            if (difference == 0)
+            {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+                    break;
+            }
+            else if (difference < 0)
+                return false;
+            else
+                pos = dequeuePos.load(memory_order_relaxed);
+        }
+
+        message = move(slot->message);
+        slot->message.clear();
+        slot->sequence.store(pos + capacity, memory_order_release);
+        return true;
+    }
+
+    // Must be called with outputMutex held, so batches are written in the order they were taken
+    string takeBatch()
+    {
+        string batch;
+        string message;
+
+        while (tryPop(message))
+            batch += message;
+
+        unsigned long long currentDroppedCount = getDroppedCount();
+
+        if (currentDroppedCount != reportedDroppedCount)
+        {
+            batch += "[TimedLog]: " + to_string(currentDroppedCount - reportedDroppedCount) +
+                " log messages were dropped because the log buffer was full\n";
+            reportedDroppedCount = currentDroppedCount;
+        }
+
+        return batch;
+    }
+
+    void run()
+    {
+        bool keepRunning = true;
+
+        while (keepRunning)
+        {
+            {
+                unique_lock<mutex> lock(wakeMutex);
+                wakeCondition.wait_for(lock, batchInterval, [this] { return !isRunning; });
+                keepRunning = isRunning;
+            }
+
+            lock_guard<mutex> lock(outputMutex);
+            string batch = takeBatch();
+
+            if (!batch.empty())
+                cout << batch << flush;
+        }
+    }
+
+    static const chrono::milliseconds batchInterval;
+
+    unique_ptr<Slot[]> buffer;
+    atomic<size_t> enqueuePos;
+    atomic<size_t> dequeuePos;
+    atomic<unsigned long long> droppedCount;
+    unsigned long long reportedDroppedCount;
+
+    mutex outputMutex;
+    mutex wakeMutex;
+    condition_variable wakeCondition;
+    bool isRunning;
+    thread writerThread;
+};
+
+const chrono::milliseconds AsyncLogWriter::batchInterval(20);
+
 TimedLog *TimedLog::sTimedLog = nullptr;
 
-TimedLog::TimedLog(int logLevel) : logLevel(logLevel)
+TimedLog::TimedLog(int logLevel, bool isAsync) : logLevel(logLevel), asyncWriter(nullptr)
 {
+    if (isAsync)
+        asyncWriter = new AsyncLogWriter;
+}
 
+TimedLog::~TimedLog()
+{
+    // Joins the writer thread after it has written out everything still queued
+    delete asyncWriter;
 }
 
-void TimedLog::Create(int logLevel)
+void TimedLog::Create(int logLevel, bool isAsync)
 {
     if (sTimedLog != nullptr)
         return;
-    sTimedLog = new TimedLog(logLevel);
+    sTimedLog = new TimedLog(logLevel, isAsync);
 }
 
 void TimedLog::Delete()
@@ -47,6 +232,19 @@ void TimedLog::SetLevel(int level)
     sTimedLog->logLevel = level;
 }
 
+bool TimedLog::IsEnabled(int level)
+{
+    return sTimedLog != nullptr && level >= sTimedLog->logLevel;
+}
+
+unsigned long long TimedLog::GetDroppedCount()
+{
+    if (sTimedLog == nullptr || sTimedLog->asyncWriter == nullptr)
+        return 0;
+
+    return sTimedLog->asyncWriter->getDroppedCount();
+}
+
 const char* getTime()
 {
     time_t t = time(0);
@@ -104,7 +302,14 @@ void TimedLog::print(int level, bool hasPrefix, const char *file, int line, cons
     va_start(args, message);
     vsnprintf(buf.data(), buf.size(), sstr.str().c_str(), args);
     va_end(args);
-    cout << buf.data() << flush;
+
+    if (asyncWriter == nullptr)
+        cout << buf.data() << flush;
+    // Make sure errors reach the log even if the program goes down right after them
+    else if (level >= LOG_ERROR)
+        asyncWriter->pushAndFlush(string(buf.data()));
+    else
+        asyncWriter->push(string(buf.data()));
 }
 
 string TimedLog::getFilenameTimestamp()
@@ -9,23 +9,28 @@
 
 #if defined(NOLOGS)
 #define LOG_INIT(logLevel)
+#define LOG_INIT_ASYNC(logLevel)
 #define LOG_QUIT()
 #define LOG_MESSAGE(level, msg, ...)
 #define LOG_MESSAGE_SIMPLE(level, msg, ...)
 #else
 #define LOG_INIT(logLevel) TimedLog::Create(logLevel)
+#define LOG_INIT_ASYNC(logLevel) TimedLog::Create(logLevel, true)
 #define LOG_QUIT() TimedLog::Delete()
+// The level is checked before the arguments are evaluated, so that dropped messages don't build any strings
 #if defined(_MSC_VER)
-#define LOG_MESSAGE(level, msg, ...) TimedLog::Get().print((level), (1), (__FILE__), (__LINE__), (msg), __VA_ARGS__)
-#define LOG_MESSAGE_SIMPLE(level, msg, ...) TimedLog::Get().print((level), (1), (0), (0), (msg), __VA_ARGS__)
-#define LOG_APPEND(level, msg, ...) TimedLog::Get().print((level), (0), (0), (0), (msg), __VA_ARGS__)
+#define LOG_MESSAGE(level, msg, ...) do { if (TimedLog::IsEnabled(level)) TimedLog::Get().print((level), (1), (__FILE__), (__LINE__), (msg), __VA_ARGS__); } while (0)
+#define LOG_MESSAGE_SIMPLE(level, msg, ...) do { if (TimedLog::IsEnabled(level)) TimedLog::Get().print((level), (1), (0), (0), (msg), __VA_ARGS__); } while (0)
+#define LOG_APPEND(level, msg, ...) do { if (TimedLog::IsEnabled(level)) TimedLog::Get().print((level), (0), (0), (0), (msg), __VA_ARGS__); } while (0)
 #else
-#define LOG_MESSAGE(level, msg, args...) TimedLog::Get().print((level), (1), (__FILE__), (__LINE__), (msg), ##args)
-#define LOG_MESSAGE_SIMPLE(level, msg, args...) TimedLog::Get().print((level), (1), (0), (0), (msg), ##args)
-#define LOG_APPEND(level, msg, args...) TimedLog::Get().print((level), (0), (0), (0), (msg), ##args)
+#define LOG_MESSAGE(level, msg, args...) do { if (TimedLog::IsEnabled(level)) TimedLog::Get().print((level), (1), (__FILE__), (__LINE__), (msg), ##args); } while (0)
+#define LOG_MESSAGE_SIMPLE(level, msg, args...) do { if (TimedLog::IsEnabled(level)) TimedLog::Get().print((level), (1), (0), (0), (msg), ##args); } while (0)
+#define LOG_APPEND(level, msg, args...) do { if (TimedLog::IsEnabled(level)) TimedLog::Get().print((level), (0), (0), (0), (msg), ##args); } while (0)
 #endif
 #endif
 
+class AsyncLogWriter;
+
 class TimedLog
 {
 public:
@@ -35,24 +40,32 @@ public:
         LOG_INFO,
         LOG_WARN,
         LOG_ERROR,
-        LOG_FATAL
+        LOG_FATAL,
+        // Not a log level that can be chosen; messages at it get past any of them and are labelled as info
+        LOG_ALWAYS
     };
-    static void Create(int logLevel);
+    static void Create(int logLevel, bool isAsync = false);
     static void Delete();
     static const TimedLog &Get();
     static int GetLevel();
     static void SetLevel(int level);
+    static bool IsEnabled(int level);
     void print(int level, bool hasPrefix, const char *file, int line, const char *message, ...) const;
 
+    // Get the number of messages dropped because the asynchronous writer could not keep up
+    static unsigned long long GetDroppedCount();
+
     static std::string getFilenameTimestamp();
 private:
-    TimedLog(int logLevel);
+    TimedLog(int logLevel, bool isAsync);
+    ~TimedLog();
     /// Not implemented
     TimedLog(const TimedLog &) = delete;
     /// Not implemented
     TimedLog &operator=(TimedLog &) = delete;
     static TimedLog *sTimedLog;
     int logLevel;
+    AsyncLogWriter *asyncWriter;
 };
 
 
@@ -1,4 +1,5 @@
 #include "Utils.hpp"
+#include "TimedLog.hpp"
 
 #include <cstdio>
 #include <cstring>
@@ -209,12 +210,14 @@ std::string Utils::getArchitectureType()
 
 void Utils::printVersion(std::string appName, std::string version, std::string commitHash, int protocol)
 {
-    cout << appName << " " << version;
-    cout << " (" << getOperatingSystemType() << " " << getArchitectureType() << ")" << endl;
-    cout << "Protocol version: " << protocol << endl;
-    cout << "Oldest compatible commit hash: " << commitHash.substr(0, 10) << endl;
+    // Go through the logger rather than cout, which its writer thread may be using at the same time,
+    // without letting the chosen log level hide the banner
+    LOG_MESSAGE_SIMPLE(TimedLog::LOG_ALWAYS, "%s %s (%s %s)", appName.c_str(), version.c_str(),
+        getOperatingSystemType().c_str(), getArchitectureType().c_str());
+    LOG_APPEND(TimedLog::LOG_ALWAYS, "Protocol version: %i", protocol);
+    LOG_APPEND(TimedLog::LOG_ALWAYS, "Oldest compatible commit hash: %s", commitHash.substr(0, 10).c_str());
 
-    cout << "------------------------------------------------------------" << endl;
+    LOG_APPEND(TimedLog::LOG_ALWAYS, "------------------------------------------------------------");
 }
 
 void Utils::printWithWidth(ostringstream &sstr, string str, size_t width)
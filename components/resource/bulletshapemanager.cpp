@@ -113,12 +113,9 @@ osg::ref_ptr<const BulletShape> BulletShapeManager::getShape(const std::string &
     std::string normalized = name;
     mVFS->normalizeFilename(normalized);
 
-    osg::ref_ptr<BulletShape> shape;
-    osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
-    if (obj)
-        shape = osg::ref_ptr<BulletShape>(static_cast<BulletShape*>(obj.get()));
-    else
+    osg::ref_ptr<osg::Object> obj = getOrLoad(normalized, [&] () -> osg::ref_ptr<osg::Object>
     {
+        osg::ref_ptr<BulletShape> shape;
         size_t extPos = normalized.find_last_of('.');
         std::string ext;
         if (extPos != std::string::npos && extPos+1 < normalized.size())
@@ -138,13 +135,11 @@ osg::ref_ptr<const BulletShape> BulletShapeManager::getShape(const std::string &
             NodeToShapeVisitor visitor;
             node->accept(visitor);
             shape = visitor.getShape();
-            if (!shape)
-                return osg::ref_ptr<BulletShape>();
         }
 
-        mCache->addEntryToObjectCache(normalized, shape);
-    }
-    return shape;
+        return shape;
+    });
+    return osg::ref_ptr<const BulletShape>(static_cast<BulletShape*>(obj.get()));
 }
 
 osg::ref_ptr<BulletShapeInstance> BulletShapeManager::cacheInstance(const std::string &name)
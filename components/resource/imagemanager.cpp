@@ -86,10 +86,7 @@ namespace Resource
         std::string normalized = filename;
         mVFS->normalizeFilename(normalized);
 
-        osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
-        if (obj)
-            return osg::ref_ptr<osg::Image>(static_cast<osg::Image*>(obj.get()));
-        else
+        osg::ref_ptr<osg::Object> obj = getOrLoad(normalized, [&] () -> osg::ref_ptr<osg::Object>
         {
             Files::IStreamPtr stream;
             try
@@ -99,7 +96,6 @@ namespace Resource
             catch (std::exception& e)
             {
                 Log(Debug::Error) << "Failed to open image: " << e.what();
-                mCache->addEntryToObjectCache(normalized, mWarningImage);
                 return mWarningImage;
             }
 
@@ -111,7 +107,6 @@ namespace Resource
             if (!reader)
             {
                 Log(Debug::Error) << "Error loading " << filename << ": no readerwriter for '" << ext << "' found";
-                mCache->addEntryToObjectCache(normalized, mWarningImage);
                 return mWarningImage;
             }
 
@@ -119,7 +114,6 @@ namespace Resource
             if (!result.success())
             {
                 Log(Debug::Error) << "Error loading " << filename << ": " << result.message() << " code " << result.status();
-                mCache->addEntryToObjectCache(normalized, mWarningImage);
                 return mWarningImage;
             }
 
@@ -132,7 +126,6 @@ namespace Resource
                 if (!uncompress)
                 {
                     Log(Debug::Error) << "Error loading " << filename << ": no S3TC texture compression support installed";
-                    mCache->addEntryToObjectCache(normalized, mWarningImage);
                     return mWarningImage;
                 }
                 else
@@ -150,9 +143,9 @@ namespace Resource
                 }
             }
 
-            mCache->addEntryToObjectCache(normalized, image);
             return image;
-        }
+        });
+        return osg::ref_ptr<osg::Image>(static_cast<osg::Image*>(obj.get()));
     }
 
     osg::Image *ImageManager::getWarningImage()
@@ -44,16 +44,12 @@ namespace Resource
 
     Nif::NIFFilePtr NifFileManager::get(const std::string &name)
     {
-        osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(name);
-        if (obj)
-            return static_cast<NifFileHolder*>(obj.get())->mNifFile;
-        else
+        osg::ref_ptr<osg::Object> obj = getOrLoad(name, [&] () -> osg::ref_ptr<osg::Object>
         {
             Nif::NIFFilePtr file (new Nif::NIFFile(mVFS->get(name), name));
-            obj = new NifFileHolder(file);
-            mCache->addEntryToObjectCache(name, obj);
-            return file;
-        }
+            return new NifFileHolder(file);
+        });
+        return static_cast<NifFileHolder*>(obj.get())->mNifFile;
     }
 
     void NifFileManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
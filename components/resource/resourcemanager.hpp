@@ -1,6 +1,11 @@
 #ifndef OPENMW_COMPONENTS_RESOURCE_MANAGER_H
 #define OPENMW_COMPONENTS_RESOURCE_MANAGER_H
 
+#include <future>
+#include <map>
+#include <mutex>
+
+#include <osg/Object>
 #include <osg/ref_ptr>
 
 #include "objectcache.hpp"
@@ -67,9 +72,70 @@ namespace Resource
         virtual void releaseGLObjects(osg::State* state) { mCache->releaseGLObjects(state); }
 
     protected:
+        /// Get the object cached under this key, or load and cache it with the given function.
+        /// @par Threads asking for a key that another thread is loading wait for that load instead of starting their own,
+        /// so a resource requested by the preloader and the main thread at once is only loaded once. If the load throws,
+        /// every waiting thread gets the same exception.
+        /// @note A null object returned by the load function is handed out, but not cached.
+        template <class Function>
+        osg::ref_ptr<osg::Object> getOrLoad(const KeyType& key, Function&& load)
+        {
+            osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(key);
+            if (obj)
+                return obj;
+
+            std::promise<osg::ref_ptr<osg::Object> > promise;
+            {
+                std::unique_lock<std::mutex> lock(mLoadingMutex);
+                typename LoadingMap::iterator found = mLoading.find(key);
+                if (found != mLoading.end())
+                {
+                    std::shared_future<osg::ref_ptr<osg::Object> > result = found->second;
+                    lock.unlock();
+                    return result.get();
+                }
+
+                // The previous load of this key may have finished between the first cache check and taking the lock
+                obj = mCache->getRefFromObjectCache(key);
+                if (obj)
+                    return obj;
+
+                mLoading.emplace(key, promise.get_future().share());
+            }
+
+            try
+            {
+                obj = load();
+                if (obj)
+                    mCache->addEntryToObjectCache(key, obj);
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+                finishLoading(key);
+                throw;
+            }
+
+            promise.set_value(obj);
+            finishLoading(key);
+            return obj;
+        }
+
         const VFS::Manager* mVFS;
         osg::ref_ptr<CacheType> mCache;
         double mExpiryDelay;
+
+    private:
+        typedef std::map<KeyType, std::shared_future<osg::ref_ptr<osg::Object> > > LoadingMap;
+
+        void finishLoading(const KeyType& key)
+        {
+            std::lock_guard<std::mutex> lock(mLoadingMutex);
+            mLoading.erase(key);
+        }
+
+        std::mutex mLoadingMutex;
+        LoadingMap mLoading;
     };
 
 
@@ -471,17 +471,16 @@ namespace Resource
         std::string normalized = name;
         mVFS->normalizeFilename(normalized);
 
-        osg::ref_ptr<osg::Object> obj = mCache->getRefFromObjectCache(normalized);
-        if (obj)
-            return osg::ref_ptr<const osg::Node>(static_cast<osg::Node*>(obj.get()));
-        else
+        osg::ref_ptr<osg::Object> obj = getOrLoad(normalized, [&] () -> osg::ref_ptr<osg::Object>
         {
+            // The fallback below loads a different file, but the result is still cached under the requested name
+            std::string path = normalized;
             osg::ref_ptr<osg::Node> loaded;
             try
             {
-                Files::IStreamPtr file = mVFS->get(normalized);
+                Files::IStreamPtr file = mVFS->get(path);
 
-                loaded = load(file, normalized, mImageManager, mNifFileManager);
+                loaded = load(file, path, mImageManager, mNifFileManager);
             }
             catch (std::exception& e)
             {
@@ -489,12 +488,12 @@ namespace Resource
 
                 for (unsigned int i=0; i<sizeof(sMeshTypes)/sizeof(sMeshTypes[0]); ++i)
                 {
-                    normalized = "meshes/marker_error." + std::string(sMeshTypes[i]);
-                    if (mVFS->exists(normalized))
+                    path = "meshes/marker_error." + std::string(sMeshTypes[i]);
+                    if (mVFS->exists(path))
                     {
                         Log(Debug::Error) << "Failed to load '" << name << "': " << e.what() << ", using marker_error." << sMeshTypes[i] << " instead";
-                        Files::IStreamPtr file = mVFS->get(normalized);
-                        loaded = load(file, normalized, mImageManager, mNifFileManager);
+                        Files::IStreamPtr file = mVFS->get(path);
+                        loaded = load(file, path, mImageManager, mNifFileManager);
                         break;
                     }
                 }
@@ -519,7 +518,7 @@ namespace Resource
             mSharedStateManager->share(loaded.get());
             mSharedStateMutex.unlock();
 
-            if (canOptimize(normalized))
+            if (canOptimize(path))
             {
                 SceneUtil::Optimizer optimizer;
                 optimizer.setIsOperationPermissibleForObjectCallback(new CanOptimizeCallback);
@@ -534,9 +533,9 @@ namespace Resource
             else
                 loaded->getBound();
 
-            mCache->addEntryToObjectCache(normalized, loaded);
             return loaded;
-        }
+        });
+        return osg::ref_ptr<const osg::Node>(static_cast<osg::Node*>(obj.get()));
     }
 
     osg::ref_ptr<osg::Node> SceneManager::cacheInstance(const std::string &name)
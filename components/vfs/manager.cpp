@@ -19,12 +19,41 @@ namespace
         return ch == '\\' ? '/' : Misc::StringUtils::toLower(ch);
     }
 
+    char identity_char(char ch)
+    {
+        return ch;
+    }
+
     void normalize_path(std::string& path, bool strict)
     {
         char (*normalize_char)(char) = strict ? &strict_normalize_char : &nonstrict_normalize_char;
         std::transform(path.begin(), path.end(), path.begin(), normalize_char);
     }
 
+    /// FNV-1a over the normalized characters of the name, so the name never needs to be copied to be looked up.
+    size_t hash_path(const std::string& name, char (*normalize_function)(char))
+    {
+        size_t hash = static_cast<size_t>(14695981039346656037ULL);
+        for (char ch : name)
+        {
+            hash ^= static_cast<unsigned char>(normalize_function(ch));
+            hash *= static_cast<size_t>(1099511628211ULL);
+        }
+        return hash;
+    }
+
+    bool equals_normalized(const std::string& name, const std::string& normalized, char (*normalize_function)(char))
+    {
+        if (name.size() != normalized.size())
+            return false;
+        for (size_t i = 0; i < name.size(); ++i)
+        {
+            if (normalize_function(name[i]) != normalized[i])
+                return false;
+        }
+        return true;
+    }
+
 }
 
 namespace VFS
@@ -44,6 +73,7 @@ namespace VFS
     void Manager::reset()
     {
         mIndex.clear();
+        mHashIndex.clear();
         for (std::vector<Archive*>::iterator it = mArchives.begin(); it != mArchives.end(); ++it)
             delete *it;
         mArchives.clear();
@@ -60,30 +90,65 @@ namespace VFS
 
         for (std::vector<Archive*>::const_iterator it = mArchives.begin(); it != mArchives.end(); ++it)
             (*it)->listResources(mIndex, mStrict ? &strict_normalize_char : &nonstrict_normalize_char);
+
+        // Keep the table at most half full so probe sequences stay short
+        size_t size = 16;
+        while (size < mIndex.size() * 2)
+            size *= 2;
+
+        mHashIndex.assign(size, Slot{0, nullptr, nullptr});
+        const size_t mask = size - 1;
+
+        for (std::map<std::string, File*>::const_iterator it = mIndex.begin(); it != mIndex.end(); ++it)
+        {
+            size_t hash = hash_path(it->first, &identity_char);
+            size_t pos = hash & mask;
+            while (mHashIndex[pos].mName)
+                pos = (pos + 1) & mask;
+            mHashIndex[pos] = Slot{hash, &it->first, it->second};
+        }
     }
 
-    Files::IStreamPtr Manager::get(const std::string &name) const
+    File* Manager::lookup(const std::string &name, char (*normalize_function)(char)) const
     {
-        std::string normalized = name;
-        normalize_path(normalized, mStrict);
+        if (mHashIndex.empty())
+            return nullptr;
+
+        const size_t hash = hash_path(name, normalize_function);
+        const size_t mask = mHashIndex.size() - 1;
+
+        for (size_t pos = hash & mask; mHashIndex[pos].mName; pos = (pos + 1) & mask)
+        {
+            const Slot& slot = mHashIndex[pos];
+            if (slot.mHash == hash && equals_normalized(name, *slot.mName, normalize_function))
+                return slot.mFile;
+        }
+        return nullptr;
+    }
 
-        return getNormalized(normalized);
+    Files::IStreamPtr Manager::get(const std::string &name) const
+    {
+        File* file = lookup(name, mStrict ? &strict_normalize_char : &nonstrict_normalize_char);
+        if (!file)
+        {
+            std::string normalized = name;
+            normalize_path(normalized, mStrict);
+            throw std::runtime_error("Resource '" + normalized + "' not found");
+        }
+        return file->open();
     }
 
     Files::IStreamPtr Manager::getNormalized(const std::string &normalizedName) const
     {
-        std::map<std::string, File*>::const_iterator found = mIndex.find(normalizedName);
-        if (found == mIndex.end())
+        File* file = lookup(normalizedName, &identity_char);
+        if (!file)
             throw std::runtime_error("Resource '" + normalizedName + "' not found");
-        return found->second->open();
+        return file->open();
     }
 
     bool Manager::exists(const std::string &name) const
     {
-        std::string normalized = name;
-        normalize_path(normalized, mStrict);
-
-        return mIndex.find(normalized) != mIndex.end();
+        return lookup(name, mStrict ? &strict_normalize_char : &nonstrict_normalize_char) != nullptr;
     }
 
     const std::map<std::string, File*>& Manager::getIndex() const
@@ -96,4 +161,26 @@ namespace VFS
         normalize_path(name, mStrict);
     }
 
+    RecursiveDirectoryRange Manager::getRecursiveDirectoryIterator(const std::string& path) const
+    {
+        if (path.empty())
+            return RecursiveDirectoryRange(mIndex.begin(), mIndex.end());
+
+        std::string normalized = path;
+        normalize_path(normalized, mStrict);
+
+        std::map<std::string, File*>::const_iterator first = mIndex.lower_bound(normalized);
+
+        // Every name with this prefix sorts before the prefix with its last character incremented,
+        // unless that character is already the largest one, in which case only the end bounds them
+        while (!normalized.empty() && static_cast<unsigned char>(normalized.back()) == 0xFF)
+            normalized.pop_back();
+
+        if (normalized.empty())
+            return RecursiveDirectoryRange(first, mIndex.end());
+
+        ++normalized.back();
+        return RecursiveDirectoryRange(first, mIndex.lower_bound(normalized));
+    }
+
 }
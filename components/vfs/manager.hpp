@@ -12,6 +12,34 @@ namespace VFS
     class Archive;
     class File;
 
+    /// @brief Iterates over the names of the files in the index below a given path, in sorted order.
+    class RecursiveDirectoryIterator
+    {
+    public:
+        RecursiveDirectoryIterator(std::map<std::string, File*>::const_iterator it) : mIt(it) {}
+        const std::string& operator*() const { return mIt->first; }
+        const std::string* operator->() const { return &mIt->first; }
+        bool operator==(const RecursiveDirectoryIterator& other) const { return mIt == other.mIt; }
+        bool operator!=(const RecursiveDirectoryIterator& other) const { return mIt != other.mIt; }
+        RecursiveDirectoryIterator& operator++() { ++mIt; return *this; }
+
+    private:
+        std::map<std::string, File*>::const_iterator mIt;
+    };
+
+    /// @brief A begin/end pair of RecursiveDirectoryIterators, usable in range-based for loops.
+    class RecursiveDirectoryRange
+    {
+    public:
+        RecursiveDirectoryRange(RecursiveDirectoryIterator first, RecursiveDirectoryIterator last) : mFirst(first), mLast(last) {}
+        RecursiveDirectoryIterator begin() const { return mFirst; }
+        RecursiveDirectoryIterator end() const { return mLast; }
+
+    private:
+        RecursiveDirectoryIterator mFirst;
+        RecursiveDirectoryIterator mLast;
+    };
+
     /// @brief The main class responsible for loading files from a virtual file system.
     /// @par Various archive types (e.g. directories on the filesystem, or compressed archives)
     /// can be registered, and will be merged into a single file tree. If the same filename is
@@ -58,12 +86,31 @@ namespace VFS
         /// @note May be called from any thread once the index has been built.
         Files::IStreamPtr getNormalized(const std::string& normalizedName) const;
 
+        /// Get the names of all files whose normalized path starts with the given path, in sorted order.
+        /// @note The path is normalized first, and should end with a slash to only match files inside a directory.
+        /// @note May be called from any thread once the index has been built.
+        RecursiveDirectoryRange getRecursiveDirectoryIterator(const std::string& path) const;
+
     private:
+        /// An entry in the hashed index, pointing into mIndex.
+        struct Slot
+        {
+            size_t mHash;
+            const std::string* mName;
+            File* mFile;
+        };
+
+        /// Find a file in the hashed index, normalizing the name while hashing and comparing it.
+        File* lookup(const std::string& name, char (*normalize_function)(char)) const;
+
         bool mStrict;
 
         std::vector<Archive*> mArchives;
 
         std::map<std::string, File*> mIndex;
+
+        /// Open-addressed hash table over mIndex with a power of two size, used for constant time lookups.
+        std::vector<Slot> mHashIndex;
     };
 
 }